@@ -0,0 +1,468 @@
+#! /usr/bin/env python
+
+# Post-processes the cross section kernels which the Mathematica notebook inserts
+# into main_micromegas.c. Each kernel is rewritten with its common subexpressions
+# (v^2, the gamma factors, powers of m, the Sommerfeld exponentials) computed once
+# in local variables, and with pow() calls with (half-)integer exponents replaced
+# by multiplications and square roots. Every representation gets its own specialized
+# kernel (e.g. ss_to_qq_rep3), which <kernel>_kernel(rep) returns as a function pointer
+# so callers can resolve the kernel once. For every kernel a batch version is added
+# which evaluates arrays of velocities in a loop the compiler can vectorize.
+#
+# The notebook only inserts the sum of the partial waves into main_micromegas.c, the
+# partial waves themselves are taken from sommerfeld.py which the notebook writes from
+# the same expressions. For every <kernel>_waves dispatcher in main_micromegas.c the
+# specialized kernels (e.g. ss_to_qq_waves_rep3) are added, which evaluate all partial
+# waves at once with their common subexpressions computed once.
+#
+# Usage: ./kernel_codegen.py main_micromegas.c
+# (run after the notebook has written main_micromegas.c and sommerfeld.py, the file is
+# updated in place)
+
+import os
+import re
+import math
+import argparse
+
+
+##########
+# parser #
+##########
+
+# Expression nodes are tuples: ('num', text), ('var', name), ('call', name, args),
+# ('add', terms), ('mul', factors), ('div', a, b) and ('neg', a).
+
+token_re = re.compile(r'\s*(?:(\d+\.\d*|\.\d+|\d+)|([A-Za-z_][A-Za-z_0-9.]*)|(.))')
+
+def tokenize(text):
+	tokens = []
+	pos = 0
+	text = text.strip()
+	while pos < len(text):
+		match = token_re.match(text, pos)
+		if match is None:
+			break
+		pos = match.end()
+		number, name, op = match.groups()
+		if number is not None:
+			tokens.append(('num', number))
+		elif name is not None:
+			tokens.append(('name', name))
+		elif op.strip():
+			tokens.append(('op', op))
+	return tokens
+
+class Parser:
+	def __init__(self, text):
+		self.tokens = tokenize(text)
+		self.pos = 0
+
+	def peek(self):
+		if self.pos < len(self.tokens):
+			return self.tokens[self.pos]
+		return (None, None)
+
+	def take(self, value=None):
+		token = self.peek()
+		if value is not None and token[1] != value:
+			raise ValueError("expected '" + value + "' but found '" + str(token[1]) + "'")
+		self.pos += 1
+		return token
+
+	def parse(self):
+		node = self.expr()
+		if self.pos != len(self.tokens):
+			raise ValueError("unexpected token '" + str(self.peek()[1]) + "'")
+		return node
+
+	def parse_list(self):
+		# Parses comma separated expressions, such as the elements of a python list.
+		nodes = [self.expr()]
+		while self.peek()[1] == ',':
+			self.take(',')
+			nodes.append(self.expr())
+		if self.pos != len(self.tokens):
+			raise ValueError("unexpected token '" + str(self.peek()[1]) + "'")
+		return nodes
+
+	def expr(self):
+		terms = [self.term()]
+		while self.peek()[1] in ('+', '-'):
+			if self.take()[1] == '+':
+				terms.append(self.term())
+			else:
+				terms.append(('neg', self.term()))
+		if len(terms) == 1:
+			return terms[0]
+		return ('add', tuple(terms))
+
+	def term(self):
+		node = self.unary()
+		factors = [node]
+		while self.peek()[1] in ('*', '/'):
+			if self.take()[1] == '*':
+				factors.append(self.unary())
+			else:
+				numerator = factors[0] if len(factors) == 1 else ('mul', tuple(factors))
+				factors = [('div', numerator, self.unary())]
+		if len(factors) == 1:
+			return factors[0]
+		return ('mul', tuple(factors))
+
+	def unary(self):
+		if self.peek()[1] == '-':
+			self.take()
+			node = self.unary()
+			if node[0] == 'num':
+				return ('num', '-' + node[1])
+			return ('neg', node)
+		return self.primary()
+
+	def primary(self):
+		kind, value = self.take()
+		if kind == 'num':
+			return ('num', value)
+		if kind == 'name':
+			if self.peek()[1] == '(':
+				self.take('(')
+				args = [self.expr()]
+				while self.peek()[1] == ',':
+					self.take(',')
+					args.append(self.expr())
+				self.take(')')
+				return ('call', value, tuple(args))
+			return ('var', value)
+		if value == '(':
+			node = self.expr()
+			self.take(')')
+			return node
+		raise ValueError("unexpected token '" + str(value) + "'")
+
+
+###########
+# helpers #
+###########
+
+# Names which are compile time constants in the generated code.
+constant_names = {'M_PI': math.pi}
+
+def is_constant(node):
+	if node[0] == 'num':
+		return True
+	if node[0] == 'var':
+		return node[1] in constant_names
+	if node[0] == 'call':
+		return all(is_constant(arg) for arg in node[2])
+	if node[0] in ('add', 'mul'):
+		return all(is_constant(child) for child in node[1])
+	if node[0] == 'div':
+		return is_constant(node[1]) and is_constant(node[2])
+	return is_constant(node[1])
+
+def evaluate_constant(node):
+	if node[0] == 'num':
+		return float(node[1])
+	if node[0] == 'var':
+		return constant_names[node[1]]
+	if node[0] == 'call' and node[1] == 'pow':
+		return math.pow(evaluate_constant(node[2][0]), evaluate_constant(node[2][1]))
+	if node[0] == 'add':
+		return sum(evaluate_constant(child) for child in node[1])
+	if node[0] == 'mul':
+		result = 1.0
+		for child in node[1]:
+			result *= evaluate_constant(child)
+		return result
+	if node[0] == 'div':
+		return evaluate_constant(node[1]) / evaluate_constant(node[2])
+	if node[0] == 'neg':
+		return -evaluate_constant(node[1])
+	raise ValueError("can not evaluate constant " + str(node))
+
+def to_c(node, names=None):
+	# Converts a node to C code, subexpressions in names are replaced by their variable.
+	if names is not None and node in names:
+		return names[node]
+	kind = node[0]
+	if kind in ('num', 'var'):
+		return node[1]
+	if kind == 'call':
+		return node[1] + '(' + ', '.join(to_c(arg, names) for arg in node[2]) + ')'
+	if kind == 'add':
+		return '(' + ' + '.join(to_c(child, names) for child in node[1]) + ')'
+	if kind == 'mul':
+		return '(' + ' * '.join(to_c(child, names) for child in node[1]) + ')'
+	if kind == 'div':
+		return '(' + to_c(node[1], names) + ' / ' + to_c(node[2], names) + ')'
+	if kind == 'neg':
+		return '(-' + to_c(node[1], names) + ')'
+	raise ValueError("unknown node " + str(node))
+
+
+##################
+# simplification #
+##################
+
+def simplify_pow(base, exponent):
+	# Replaces pow with (half-)integer exponents by products and square roots.
+	if is_constant(base) or not is_constant(exponent):
+		return ('call', 'pow', (base, exponent))
+	value = evaluate_constant(exponent)
+	twice = int(round(2 * value))
+	if abs(2 * value - twice) > 1e-12 or twice == 0 or abs(twice) > 16:
+		return ('call', 'pow', (base, exponent))
+	factors = [base] * (abs(twice) // 2)
+	if abs(twice) % 2 == 1:
+		factors.append(('call', 'sqrt', (base,)))
+	positive = factors[0] if len(factors) == 1 else ('mul', tuple(factors))
+	if twice < 0:
+		return ('div', ('num', '1.0'), positive)
+	return positive
+
+def simplify(node):
+	kind = node[0]
+	if kind in ('num', 'var'):
+		return node
+	if kind == 'call':
+		args = tuple(simplify(arg) for arg in node[2])
+		if node[1] == 'pow' and len(args) == 2:
+			return simplify_pow(args[0], args[1])
+		return ('call', node[1], args)
+	if kind in ('add', 'mul'):
+		return (kind, tuple(simplify(child) for child in node[1]))
+	if kind == 'div':
+		return ('div', simplify(node[1]), simplify(node[2]))
+	return ('neg', simplify(node[1]))
+
+
+#############################
+# common subexpression pass #
+#############################
+
+def children(node):
+	kind = node[0]
+	if kind == 'call':
+		return node[2]
+	if kind in ('add', 'mul'):
+		return node[1]
+	if kind == 'div':
+		return (node[1], node[2])
+	if kind == 'neg':
+		return (node[1],)
+	return ()
+
+def count_uses(node, uses, order):
+	# Counts how often each non-trivial subexpression is used, the children of a
+	# repeated subexpression are only counted once.
+	if node[0] in ('num', 'var') or is_constant(node):
+		return
+	if node in uses:
+		uses[node] += 1
+		return
+	for child in children(node):
+		count_uses(child, uses, order)
+	uses[node] = 1
+	order.append(node)
+
+def eliminate(expressions, prefix='x'):
+	# Returns a list of (name, code) definitions and the code for each expression.
+	uses = {}
+	order = []
+	for expression in expressions:
+		count_uses(expression, uses, order)
+	names = {}
+	definitions = []
+	for node in order:
+		if uses[node] < 2:
+			continue
+		code = to_c(node, names)
+		# Strip the outer parenthesis for readability.
+		if code.startswith('(') and node[0] != 'call':
+			code = code[1:-1]
+		name = prefix + str(len(definitions))
+		definitions.append((name, code))
+		names[node] = name
+	return definitions, [to_c(expression, names) for expression in expressions]
+
+
+##########################
+# main_micromegas.c pass #
+##########################
+
+function_re = re.compile(r'^double (\w+_to_\w+)\((double alpha_s, double alpha_sommerfeld, int rep, double m, double v)\)\n\{\n\tswitch \(rep\)\n\t\{\n((?:\t\tcase \d+: return .*;\n)+)(\t\tdefault: .*\n)\t\}\n\treturn 0.0;\n\}\n', re.M)
+case_re = re.compile(r'^\t\tcase (\d+): return (.*);$', re.M)
+
+# Functions which are replaced by their vectorizable versions in the batch kernels.
+batch_functions = {'exp': 'exp_simd', 'invexp': 'invexp_simd', 'sqrt': 'sqrt_simd'}
+
+def rename_calls(node, renames):
+	kind = node[0]
+	if kind == 'call':
+		return ('call', renames.get(node[1], node[1]), tuple(rename_calls(arg, renames) for arg in node[2]))
+	if kind in ('add', 'mul'):
+		return (kind, tuple(rename_calls(child, renames) for child in node[1]))
+	if kind == 'div':
+		return ('div', rename_calls(node[1], renames), rename_calls(node[2], renames))
+	if kind == 'neg':
+		return ('neg', rename_calls(node[1], renames))
+	return node
+
+def specialized_kernel(name, rep, expression):
+	definitions, results = eliminate([expression])
+	lines = ['double ' + name + '_rep' + rep + '(double alpha_s, double alpha_sommerfeld, double m, double v)', '{']
+	for variable, code in definitions:
+		lines.append('\tdouble ' + variable + ' = ' + code + ';')
+	lines += ['\treturn ' + results[0] + ';', '}', '']
+	return lines
+
+def scalar_kernel(name, arguments, cases, default):
+	lines = []
+	for rep, expression in cases:
+		lines += specialized_kernel(name, rep, expression)
+	lines += ['double ' + name + '(' + arguments + ')', '{', '\tswitch (rep)', '\t{']
+	for rep, _ in cases:
+		lines.append('\t\tcase ' + rep + ': return ' + name + '_rep' + rep + '(alpha_s, alpha_sommerfeld, m, v);')
+	lines.append(default)
+	lines += ['\t}', '\treturn 0.0;', '}', '']
+	return lines
+
+def kernel_resolver(name, cases):
+	# Returns the specialized kernel for a representation, such that it is resolved once per particle.
+	lines = ['XsecKernel ' + name + '_kernel(int rep)', '{', '\tswitch (rep)', '\t{']
+	for rep, _ in cases:
+		lines.append('\t\tcase ' + rep + ': return ' + name + '_rep' + rep + ';')
+	lines.append('\t\tdefault: printf("WARNING: ' + name + '_kernel called for invalid representation %d.\\n", rep); return NULL;')
+	lines += ['\t}', '\treturn NULL;', '}', '']
+	return lines
+
+def batch_kernel(name, cases):
+	# The batch kernel evaluates the cross section for arrays of alpha_s, alpha_sommerfeld and v,
+	# it is compiled for several instruction sets and the loops are vectorized by the compiler.
+	lines = ['BATCH_TARGETS void ' + name + '_batch(const double *alpha_s_list, const double *alpha_sommerfeld_list, int rep, double m, const double *v_list, double *out, int n)', '{', '\tswitch (rep)', '\t{']
+	for rep, expression in cases:
+		definitions, results = eliminate([rename_calls(expression, batch_functions)])
+		code = ' '.join(c for _, c in definitions) + ' ' + results[0]
+		lines.append('\t\tcase ' + rep + ':')
+		lines.append('\t\t\tfor (int i = 0; i < n; i++)')
+		lines.append('\t\t\t{')
+		for variable in ('alpha_s', 'alpha_sommerfeld', 'v'):
+			if re.search(r'\b' + variable + r'\b', code):
+				lines.append('\t\t\t\tdouble ' + variable + ' = ' + variable + '_list[i];')
+		for variable, code in definitions:
+			lines.append('\t\t\t\tdouble ' + variable + ' = ' + code + ';')
+		lines.append('\t\t\t\tout[i] = ' + results[0] + ';')
+		lines.append('\t\t\t}')
+		lines.append('\t\t\treturn;')
+	lines.append('\t\tdefault:')
+	lines.append('\t\t\tprintf("WARNING: ' + name + '_batch called for invalid representation %d.\\n", rep);')
+	lines.append('\t\t\tfor (int i = 0; i < n; i++)')
+	lines.append('\t\t\t\tout[i] = 0.0;')
+	lines.append('\t\t\treturn;')
+	lines += ['\t}', '}', '']
+	return lines
+
+def rewrite_kernel(match):
+	name, arguments, cases, default = match.groups()
+	# Dispatchers to the specialized kernels have already been rewritten.
+	if all(case.group(2).startswith(name + '_rep') for case in case_re.finditer(cases)):
+		return match.group(0)
+	cases = [(case.group(1), simplify(Parser(case.group(2)).parse())) for case in case_re.finditer(cases)]
+	lines = scalar_kernel(name, arguments, cases, default.rstrip('\n'))
+	lines += kernel_resolver(name, cases)
+	lines.append('')
+	lines += batch_kernel(name, cases)
+	return '\n'.join(lines)
+
+def rewrite_file(source):
+	rewritten = []
+	def rewrite(match):
+		result = rewrite_kernel(match)
+		if result != match.group(0):
+			rewritten.append(match.group(1))
+		return result
+	return function_re.sub(rewrite, source), len(rewritten)
+
+
+########################
+# partial wave kernels #
+########################
+
+python_function_re = re.compile(r'^def waves_(\w\w)to(\w\w)_(\d+)\(.*\):\n\tif not sommerfeld:\n\t\treturn \[(.*)\]\n\treturn \[(.*)\]\n', re.M)
+waves_re = re.compile(r'^void (\w+_to_\w+)_waves\(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double \*waves\)\n\{\n\tswitch \(rep\)\n\t\{\n((?:\t\tcase \d+: .*\n)+)', re.M)
+waves_case_re = re.compile(r'^\t\tcase (\d+): ', re.M)
+
+# Names of sommerfeld.py and their equivalent in main_micromegas.c.
+python_names = {'mpmath.power': 'pow', 'mpmath.exp': 'exp', 'mpmath.fabs': 'fabs', 'mpmath.sqrt': 'sqrt', 'mpmath.pi': 'M_PI', 'alphas': 'alpha_s', 'alphasommerfeld': 'alpha_sommerfeld'}
+
+def from_python(node):
+	kind = node[0]
+	if kind == 'num':
+		return ('num', node[1] + '0') if node[1].endswith('.') else node
+	if kind == 'var':
+		return ('var', python_names.get(node[1], node[1]))
+	if kind == 'call':
+		return ('call', python_names.get(node[1], node[1]), tuple(from_python(arg) for arg in node[2]))
+	if kind in ('add', 'mul'):
+		return (kind, tuple(from_python(child) for child in node[1]))
+	if kind == 'div':
+		return ('div', from_python(node[1]), from_python(node[2]))
+	return ('neg', from_python(node[1]))
+
+def read_partial_waves(python_source):
+	# Returns the partial waves for each kernel name and representation, e.g. waves['ss_to_qq_sommerfeld']['3'].
+	waves = {}
+	for match in python_function_re.finditer(python_source):
+		initial, final, rep, no_sommerfeld, sommerfeld = match.groups()
+		name = initial + '_to_' + final
+		for suffix, text in (('', no_sommerfeld), ('_sommerfeld', sommerfeld)):
+			expressions = [simplify(from_python(node)) for node in Parser(text).parse_list()]
+			waves.setdefault(name + suffix, {})[rep] = expressions
+	return waves
+
+def waves_kernel(name, rep, expressions):
+	# The partial waves share their subexpressions, constant waves are assigned directly.
+	definitions, results = eliminate(expressions)
+	lines = ['void ' + name + '_waves_rep' + rep + '(double alpha_s, double alpha_sommerfeld, double m, double v, double *waves)', '{']
+	for variable, code in definitions:
+		lines.append('\tdouble ' + variable + ' = ' + code + ';')
+	for l, result in enumerate(results):
+		lines.append('\twaves[' + str(l) + '] = ' + result + ';')
+	lines += ['}', '']
+	return lines
+
+def add_wave_kernels(source, waves):
+	added = []
+	def add(match):
+		name = match.group(1)
+		lines = []
+		for rep in waves_case_re.findall(match.group(2)):
+			# Kernels which already exist are kept.
+			if re.search(r'^void ' + name + '_waves_rep' + rep + r'\(', source, re.M):
+				continue
+			if name not in waves or rep not in waves[name]:
+				raise ValueError('sommerfeld.py has no partial waves for ' + name + ' with representation ' + rep)
+			lines += waves_kernel(name, rep, waves[name][rep])
+			added.append(name + '_waves_rep' + rep)
+		return '\n'.join(lines + [match.group(0)])
+	return waves_re.sub(add, source), len(added)
+
+
+###############
+# main script #
+###############
+
+if __name__ == '__main__':
+	parser = argparse.ArgumentParser(description='Rewrites the cross section kernels in main_micromegas.c with common subexpressions computed once.')
+	parser.add_argument('file', nargs='?', default='main_micromegas.c', help='the C file with the kernels (default: main_micromegas.c)')
+	parser.add_argument('-o', '--output', action='store', help='write the result to this file instead of updating the input file')
+	parser.add_argument('-w', '--waves', action='store', help='the python script with the partial waves (default: sommerfeld.py next to the C file)')
+	args = parser.parse_args()
+
+	with open(args.file) as input_file:
+		source = input_file.read()
+	source, nr_kernels = rewrite_file(source)
+	with open(args.waves or os.path.join(os.path.dirname(args.file), 'sommerfeld.py')) as waves_file:
+		source, nr_wave_kernels = add_wave_kernels(source, read_partial_waves(waves_file.read()))
+	with open(args.output or args.file, 'w') as output_file:
+		output_file.write(source)
+	print('Rewrote ' + str(nr_kernels) + ' kernels and added ' + str(nr_wave_kernels) + ' partial wave kernels in ' + (args.output or args.file))
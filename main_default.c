@@ -12,32 +12,353 @@
 	This code needs a modified version of micrOMEGAs v4.3.2 and a diff can be
 	found in this file "micromegas_4.3.2_bound_states.patch".
 
+	The cross sections inserted by the Mathematica notebook are rewritten with
+	common subexpressions computed once by running
+		./kernel_codegen.py main_micromegas.c
+	on the output of the notebook.
+
 	Run the code as
-		./main <file with parameters> <sommerfeld> <bound state formation>
+		./main <file with parameters> <sommerfeld> <bound state formation> <cross section cache>
 	for example
 		./main data.par off on
-	to run without Sommerfeld corrections but with bound state corrections.
+	to run without Sommerfeld corrections but with bound state corrections. The
+	optional cross section cache tabulates the corrected cross sections once per
+	channel and interpolates them, its value is the relative precision of the
+	interpolation (e.g. 1e-4), "on" for the default precision or "off".
+
+	Several combinations of the corrections can be calculated in one run with
+		./main <file with parameters> --scenarios <scenarios> <cross section cache>
+	where the scenarios are "all" or a comma separated list of none, sommerfeld,
+	bsf and sommerfeld+bsf, for example
+		./main data.par --scenarios none,sommerfeld+bsf
+	The model is set up once and the relic densities of all scenarios are printed
+	in the last line of the output:
+		omega_h^2(scenarios): none=<omega> sommerfeld+bsf=<omega>
+
+	A grid in the dark matter mass MDM and the relative mass splitting delta,
+	with MX = MDM * (1 + delta), is scanned in a single run with
+		./main <file with parameters> --grid <mdm range> <delta range> <output file> <cross section cache>
+	where a range is given as min:max:step, for example
+		./main data.par --grid 1:6001:25 0:0.25:0.005 rd_mass_delta.txt
+	The other parameters are taken from the parameter file. For each point a row
+	with delta, the masses and the relic densities of all scenarios is written.
+	Add "--jobs <number of workers>" to the arguments to scan the grid with several
+	processes, for example
+		./main data.par --grid 1:6001:25 0:0.25:0.005 rd_mass_delta.txt --jobs 8
+	The rows are written in the same order as for a scan with a single process.
+
+	Add "--bsf-table" to the arguments to tabulate the averaged bound state rate on
+	a grid in log(m) and log(m / T) and interpolate it. The table is stored in a file
+	bsf_rate_<hash>.bin which is reused by later runs with the same model, processes
+	which write it at the same time take turns with the lock file bsf_rate_<hash>.bin.lock.
+
+	The integrals of the bound state rates are calculated with Simpson's rule, add
+	"--quadrature laguerre" to use a Gauss-Laguerre rule for the dissociation rate
+	and a tanh-sinh rule for the formation cross section, or "--quadrature tanh-sinh"
+	to use the latter for both. They need fewer evaluations of the integrands at the
+	same precision. With "--quadrature-benchmark" the rules are compared for the
+	bound states of the model, showing the number of evaluations of each integral
+	and the error with respect to Simpson's rule at a higher precision.
+
+	Add "--benchmark <output file>" to the arguments to time the cross sections, alpha
+	strong and the bound state rates on the kinematics of a freeze-out run of the
+	model. The calls from micrOMEGAs during the run are recorded and each function
+	is timed on them. The time per call, the calls per second and the evaluations
+	per integral are printed and written as JSON to the output file, for example
+		./main data.par --benchmark benchmark.json --quadrature laguerre
+
+	Compiled with SOMMERFELD_LIBRARY defined this file is the library libsommerfeld
+	without the main program, which exports the cross sections, alpha strong and
+	the bound state formation rate. It leaves out everything which uses micrOMEGAs
+	and has its own Bessel functions and integrand of the averaged formation cross
+	section, such that it builds without micrOMEGAs. Its interface and how to build
+	it are described in sommerfeld.h.
 --*/
 
 
+#ifndef SOMMERFELD_LIBRARY
 #include "../include/micromegas.h"
 #include "../include/micromegas_aux.h"
 #include "lib/pmodel.h"
+#else
+#include "stdio.h"
+#include "stdlib.h"
+#include "string.h"
+#include "math.h"
+#endif
 #include "stdbool.h"
+#include "stdint.h"
+#include "unistd.h"
+#include "sys/wait.h"
+#include "signal.h"
+#include "fcntl.h"
+#include "sys/mman.h"
+#include "sys/stat.h"
+#include "sys/file.h"
+#include "time.h"
+#include "errno.h"
+#ifdef SOMMERFELD_LIBRARY
+#include "sommerfeld.h"
+#endif
+
+#ifdef SOMMERFELD_LIBRARY
+// The library does not use micrOMEGAs, the parameters of the integrands are those of the
+// patched micromegas.h.
+typedef struct BoundStateParams BoundStateParams;
+typedef struct
+{
+	int spin;
+	int color;
+	double m;
+	double T;
+	const BoundStateParams *bound_state;
+	double mdm;
+} Parameters;
+
+// The library does not write to the standard output of the program which uses it, its
+// warnings go to stderr.
+#define printf(...) fprintf(stderr, __VA_ARGS__)
+#endif
+
+
+// Instruction sets for which the batch cross sections are compiled, the best one
+// supported by the cpu is selected at runtime and the others serve as fallback.
+// Contraction to fused multiply-adds is disabled to keep the batch results equal
+// to those of the scalar cross sections. Without traps on floating point exceptions
+// the compiler may evaluate both sides of a select, which does not change results.
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__)
+#define BATCH_OPTIMIZE __attribute__((optimize("tree-vectorize", "fp-contract=off", "no-trapping-math")))
+#define BATCH_TARGETS __attribute__((target_clones("avx512f", "avx2", "default"))) BATCH_OPTIMIZE
+#else
+#define BATCH_OPTIMIZE
+#define BATCH_TARGETS
+#endif
+
+// State of the corrections for a parameter point, which is defined below.
+typedef struct SommerfeldContext SommerfeldContext;
+
+// Combination of corrections for which the relic density is calculated.
+typedef struct
+{
+	const char *name;
+	bool sommerfeld, bsf;
+} Scenario;
+#define NR_SCENARIOS 4
+#ifndef SOMMERFELD_LIBRARY
+static const Scenario scenarios[NR_SCENARIOS] = {
+	{"none", false, false},
+	{"sommerfeld", true, false},
+	{"bsf", false, true},
+	{"sommerfeld+bsf", true, true}
+};
+#endif
+
+// Cross section kernel specialized for one spin and representation of X, e.g. ff_to_gg_sommerfeld_rep8.
+typedef double (*XsecKernel)(double alpha_s, double alpha_sommerfeld, double m, double v);
+
+// Properties of the bound state of two X's with mass m which do not depend on the temperature,
+// they are calculated once per particle and passed to the integrands through Parameters.
+struct BoundStateParams
+{
+	int spin, color;
+	double m;
+	double casimir;
+	double zeta, zetap, kappa;
+	// Binding energy and Bohr radius.
+	double energy, bohr_radius;
+	// Alpha strong of micrOMEGAs for the emitted gluon.
+	double alpha_s;
+};
+
+// Registry of the colored X particles and their antiparticles which is filled once after
+// sortOddParticles, such that the cross section functions do not query the model by name.
+// It is a flat hash table on the PDG code with open addressing and linear probing.
+typedef struct
+{
+	// Empty slots have PDG code zero.
+	long pdg;
+	double mass;
+	long color, spin;
+	double casimir;
+	// Kernels for XX -> qq and XX -> gg, with Sommerfeld corrections if enabled.
+	XsecKernel to_qq, to_gg;
+	// Bound state of XX, only set if the alpha table for bound states has been read.
+	BoundStateParams bound_state;
+} Particle;
+
+#define PARTICLE_REGISTRY_BITS 6
+#define PARTICLE_REGISTRY_SIZE (1 << PARTICLE_REGISTRY_BITS)
+
+// The cross section for XX -> qq or XX -> gg only depends on the momentum for a given
+// X, it is tabulated once on a grid in log(p) and interpolated with a monotone cubic.
+// The table stores log(xsec / alpha_s^2), since all cross sections are proportional to
+// alpha_s^2 a change of the micrOMEGAs alpha_s does not require a new table.
+typedef struct
+{
+	// The table is not used if it has no points.
+	int npoints;
+	double logp_min, logp_step;
+	double *logxsec;
+	double *slope;
+} XsecTable;
+
+// Range of the grid in p / m, the limits on the size of a table and the number of caches.
+#define XSEC_CACHE_PMIN 1e-6
+#define XSEC_CACHE_PMAX 10.0
+#define XSEC_CACHE_MIN_POINTS 64
+#define XSEC_CACHE_MAX_POINTS 65536
+#define XSEC_CACHE_SIZE 16
+// The cross section jumps at the thresholds of alpha_strong, so the grid is split into a
+// table between each pair of thresholds which keeps this distance in log(p) from them.
+#define XSEC_CACHE_TABLES 5
+#define XSEC_CACHE_GAP 1e-9
+
+// The particles are copied into the cache, since the registry is refilled when the masses
+// or the corrections change.
+typedef struct
+{
+	Particle x1, x2;
+	bool gluons, sommerfeld;
+	int ntables;
+	XsecTable table[XSEC_CACHE_TABLES];
+} XsecCache;
+
+// Range of a parameter in a grid scan, the maximum is included.
+typedef struct
+{
+	double min, max, step;
+	int npoints;
+} GridRange;
 
+// State of a grid scan, the results are written to the output in the order of the points.
+typedef struct
+{
+	bool done, valid;
+	double omega[NR_SCENARIOS];
+} GridResult;
 
-// Variable which sets sommerfeld corrections on or off.
-static bool sommerfeld_on;
-
-// Variable which sets bound state formation on or off.
-static bool bsf_on;
+typedef struct
+{
+	GridRange mdm, delta;
+	int npoints, nwritten;
+	GridResult *results;
+	FILE *output;
+} GridScan;
+
+// Message between the grid scan and its workers, a point of -1 requests work from the
+// scan or tells a worker to stop. It is smaller than PIPE_BUF such that writes are atomic.
+typedef struct
+{
+	int worker, point;
+	GridResult result;
+} GridMessage;
+
+// Relic density functions.
+bool parse_scenarios(const char *list, bool *selected);
+double relic_density(double *omega_fo, bool print_channels);
+void relic_density_scenarios(const bool *selected, double *omega);
+
+// Grid scan functions.
+bool parse_grid_range(const char *text, GridRange *range);
+double grid_value(const GridRange *range, int i);
+int run_grid(const GridRange *mdm_range, const GridRange *delta_range, const char *output_name, int njobs);
+int run_grid_workers(GridScan *scan, int first_point, int njobs);
+void grid_worker(const GridScan *scan, int worker, int task_fd, int result_fd);
+void grid_point(const GridScan *scan, int point, GridResult *result);
+void store_grid_result(GridScan *scan, int point, const GridResult *result);
+
+// Context functions.
+void free_sommerfeld_context(SommerfeldContext *ctx);
+
+// Particle registry functions.
+void build_particle_registry(SommerfeldContext *ctx);
+void register_particle(SommerfeldContext *ctx, long pdg, double mass);
+const Particle *find_particle(const SommerfeldContext *ctx, long pdg);
+XsecKernel xsec_kernel(long spin, long color, bool sommerfeld, bool gluons);
+
+// Cross section improvement functions.
+void improve_cross_section(SommerfeldContext *ctx, long n1, long n2, long n3, long n4, double pin, double *res);
+double xsec_analytic(const Particle *x1, const Particle *x2, double pin, bool gluons, double alpha_s);
+void print_xsec_kinematics(double m1, double m2, double pin, double alpha_s);
+
+// Cross section cache functions.
+double xsec_cached(SommerfeldContext *ctx, const Particle *x1, const Particle *x2, double pin, bool gluons, double alpha_s);
+double xsec_cache_value(const XsecCache *cache, double logp);
+void build_xsec_cache(const SommerfeldContext *ctx, XsecCache *cache);
+void build_xsec_table(const SommerfeldContext *ctx, const XsecCache *cache, XsecTable *table, double logp_min, double logp_max);
+double interpolate_xsec_table(const XsecTable *table, double logp);
+
+// Momentum cut off and MSbar quark masses which set the flavor thresholds of alpha_strong.
+#define ALPHA_STRONG_CUTOFF 1.0
+#define MCHARM 1.28
+#define MBOTTOM 4.18
+#define MTOP 160.0
+
+// Beta function coefficients of alpha_strong for nf active flavors.
+#define ZETA3 1.202056903159594
+#define BETA0(nf) ((33.0 - 2.0 * (nf)) / (12.0 * M_PI))
+#define BETA1(nf) ((153.0 - 19.0 * (nf)) / (24.0 * M_PI * M_PI))
+#define BETA2(nf) ((2857.0 - 5033.0 / 9.0 * (nf) + 325.0 / 27.0 * (nf) * (nf)) / (128.0 * M_PI * M_PI * M_PI))
+#define BETA3(nf) (((149753.0 / 6.0 + 3564.0 * ZETA3) - (1078361.0 / 162.0 + 6508.0 / 27.0 * ZETA3) * (nf) + (50065.0 / 162.0 + 6472.0 / 81.0 * ZETA3) * (nf) * (nf) + 1093.0 / 729.0 * (nf) * (nf) * (nf)) / (256.0 * M_PI * M_PI * M_PI * M_PI))
+
+// Coefficients of the four-loop expansion of alpha_strong in 1 / t and log(t) for a number
+// of active flavors, these are constant expressions evaluated by the compiler.
+typedef struct
+{
+	double lambda;
+	double inv_b0;
+	double c1, c2, c2b, c3, c3b, c3c;
+} AlphaStrongCoefficients;
+#define ALPHA_STRONG_COEFFICIENTS(nf, lambda) {lambda, 1.0 / BETA0(nf), \
+	BETA1(nf) / (BETA0(nf) * BETA0(nf)), \
+	BETA1(nf) * BETA1(nf) / (BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf)), \
+	BETA2(nf) / (BETA0(nf) * BETA0(nf) * BETA0(nf)), \
+	BETA1(nf) * BETA1(nf) * BETA1(nf) / (BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf)), \
+	3.0 * BETA1(nf) * BETA2(nf) / (BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf)), \
+	0.5 * BETA3(nf) / (BETA0(nf) * BETA0(nf) * BETA0(nf) * BETA0(nf))}
+static const AlphaStrongCoefficients alpha_strong_coefficients[4] = {
+	ALPHA_STRONG_COEFFICIENTS(3.0, 0.33348050663724466),
+	ALPHA_STRONG_COEFFICIENTS(4.0, 0.2913885366061117),
+	ALPHA_STRONG_COEFFICIENTS(5.0, 0.20953346238097081),
+	ALPHA_STRONG_COEFFICIENTS(6.0, 0.08896768177299201)
+};
+
+// Compile with -DALPHA_STRONG_SERIES to evaluate alpha_strong from a Chebyshev series of
+// 1 / alpha_strong in log(q) for each flavor region below ALPHA_STRONG_QMAX, the series
+// are fitted at startup and checked to reproduce the exact formula to ALPHA_STRONG_EPS.
+// With the precomputed coefficients the exact formula is as fast, so it is the default.
+#ifdef ALPHA_STRONG_SERIES
+#define ALPHA_STRONG_QMAX 1e8
+#define ALPHA_STRONG_EPS 1e-10
+#define ALPHA_STRONG_MAX_DEGREE 64
+#define ALPHA_STRONG_CHECKS 4096
+typedef struct
+{
+	// The exact formula is used if the degree is zero.
+	int degree;
+	double logq_min, logq_max;
+	double coefficient[ALPHA_STRONG_MAX_DEGREE];
+} ChebyshevSeries;
+static ChebyshevSeries alpha_strong_series[4];
+#endif
 
 // Helper functions.
 long color(long pdg);
 long spin(long pdg);
 double casimir2(int color);
 double invexp(double x);
+BATCH_OPTIMIZE static inline double exp_simd(double x);
+BATCH_OPTIMIZE static inline double invexp_simd(double x);
+BATCH_OPTIMIZE static inline double sqrt_simd(double x);
+BATCH_OPTIMIZE static inline double exp_cut_simd(double x);
+BATCH_OPTIMIZE static inline double atan_simd(double x);
 double alpha_strong(double q);
+double alpha_strong_exact(double q);
+void build_alpha_strong_table(void);
+#ifdef ALPHA_STRONG_SERIES
+double fit_alpha_strong(ChebyshevSeries *series, double q_min, double q_max, int degree);
+double evaluate_chebyshev(const ChebyshevSeries *series, double x);
+#endif
 
 // Cross section functions.
 double xx_to_qq(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld);
@@ -59,52 +380,504 @@ double ss_to_gg_sommerfeld(double alpha_s, double alpha_sommerfeld, int rep, dou
 double ff_to_gg_sommerfeld(double alpha_s, double alpha_sommerfeld, int rep, double m, double v);
 double vv_to_gg_sommerfeld(double alpha_s, double alpha_sommerfeld, int rep, double m, double v);
 
+// Kernel resolvers, these return the cross section kernel specialized for a representation.
+XsecKernel ss_to_qq_kernel(int rep);
+XsecKernel ff_to_qq_kernel(int rep);
+XsecKernel vv_to_qq_kernel(int rep);
+
+XsecKernel ss_to_gg_kernel(int rep);
+XsecKernel ff_to_gg_kernel(int rep);
+XsecKernel vv_to_gg_kernel(int rep);
+
+XsecKernel ss_to_qq_sommerfeld_kernel(int rep);
+XsecKernel ff_to_qq_sommerfeld_kernel(int rep);
+XsecKernel vv_to_qq_sommerfeld_kernel(int rep);
+
+XsecKernel ss_to_gg_sommerfeld_kernel(int rep);
+XsecKernel ff_to_gg_sommerfeld_kernel(int rep);
+XsecKernel vv_to_gg_sommerfeld_kernel(int rep);
+
+// Batch cross section functions, these evaluate arrays of alpha_s, alpha_sommerfeld and v.
+void xx_to_qq_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, int spin, double m, const double *v, bool sommerfeld, double *out, int n);
+void xx_to_gg_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, int spin, double m, const double *v, bool sommerfeld, double *out, int n);
+
+void ss_to_qq_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void ff_to_qq_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void vv_to_qq_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+
+void ss_to_gg_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void ff_to_gg_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void vv_to_gg_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+
+void ss_to_qq_sommerfeld_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void ff_to_qq_sommerfeld_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void vv_to_qq_sommerfeld_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+
+void ss_to_gg_sommerfeld_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void ff_to_gg_sommerfeld_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+void vv_to_gg_sommerfeld_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, double m, const double *v, double *out, int n);
+
+// Partial wave cross section functions, these evaluate the partial waves l = 0, ..., NR_PARTIAL_WAVES - 1
+// at once. The cross sections above are the sum up to l = MAX_PARTIAL_WAVE, a lower l truncates them.
+#define NR_PARTIAL_WAVES 5
+#define MAX_PARTIAL_WAVE 2
+void xx_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld, double *waves);
+void xx_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld, double *waves);
+double sum_partial_waves(const double *waves, int l);
+
+void ss_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void ff_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void vv_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+
+void ss_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void ff_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void vv_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+
+void ss_to_qq_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void ff_to_qq_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void vv_to_qq_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+
+void ss_to_gg_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void ff_to_gg_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+void vv_to_gg_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves);
+
+// Alpha strong for bound states is tabulated in a text file with a row for each mass
+// "m alpha(3) alpha(6) alpha(8)". It is converted once to a binary file with this header
+// followed by the values of all rows in native byte order, which is mapped read-only into
+// memory such that it is shared by all processes.
+#define ALPHA_TABLE_TEXT "alpha_strong_bsf.txt"
+#define ALPHA_TABLE_BINARY "alpha_strong_bsf.bin"
+#define ALPHA_TABLE_MAGIC "ASBSFTAB"
+#define ALPHA_TABLE_VERSION 1
+#define ALPHA_TABLE_COLORS 3
+typedef struct
+{
+	char magic[8];
+	int32_t version, ncolors;
+	int64_t nentries;
+	double mmin, mstep;
+} AlphaTableHeader;
+
+// Lookup of alpha strong for bound states, the values of a mass are stored for each color
+// in the order of ALPHA_TABLE_COLOR_LIST. The table is interpolated with a cubic and above
+// the last mass alpha strong is determined with the same self-consistent scale as the table.
+#define ALPHA_TABLE_COLOR_LIST {3, 6, 8}
+#define ALPHA_TAIL_EPS 1e-12
+#define ALPHA_TAIL_MAX_ITERATIONS 100
+typedef struct
+{
+	const double *values;
+	int64_t nentries;
+	int ncolors;
+	double mmin, mstep;
+} AlphaTable;
+static AlphaTable alpha_bs_table;
+
+// Components of the bound state formation rate at a temperature T, which callers can store
+// to combine them again later. The decay rates are for bound states with spin 0 and 2, the
+// latter is only formed by vectors and zero otherwise.
+typedef struct
+{
+	double T, mdm;
+	double sigma_bsf;
+	double gamma_diss;
+	double gamma_bs[2];
+} BoundStateRates;
+
+// The averaged bound state rate of an X only depends on its mass m, the temperature T and
+// the dark matter mass, it is tabulated on a grid in log(m), log(x = m / T) and log(r = m / mdm),
+// such that the points of a grid scan in the mass splitting share a table. The rows in x are
+// calculated in blocks of BSF_TABLE_X_BLOCK points when they are first needed, only in the plane
+// of r if r is on a grid point such as r = 1, and the table is stored in a file named after a
+// hash of everything the rate depends on, such that later runs and other processes reuse the
+// blocks. The rate is interpolated with a tricubic in log(rate) and calculated directly outside
+// of the grid. The relative error of the interpolation is below 5e-4, and up to 1.5e-3 at masses
+// where the Bohr momentum of the bound state crosses the top mass and alpha strong has a kink.
+#define BSF_TABLE_MMIN 1.0
+#define BSF_TABLE_MMAX 1e6
+#define BSF_TABLE_M_PER_DECADE 16
+#define BSF_TABLE_XMIN 1.0
+#define BSF_TABLE_XMAX 1e6
+#define BSF_TABLE_X_PER_DECADE 32
+#define BSF_TABLE_RMIN 1.0
+#define BSF_TABLE_RMAX 2.0
+#define BSF_TABLE_R_PER_DECADE 32
+#define BSF_TABLE_X_BLOCK 8
+#define BSF_TABLE_SIZE 8
+#define BSF_TABLE_MAGIC "BSFRATE3"
+typedef struct
+{
+	char magic[8];
+	uint64_t hash;
+	int32_t nm, nx, nr, nblocks;
+} BsfTableHeader;
+
+typedef struct
+{
+	uint64_t hash;
+	int spin, color;
+	double alpha_s;
+	int nm, nx, nr, nblocks;
+	double logm_min, logm_step, logx_min, logx_step, logr_min, logr_step;
+	// Blocks in x which have been calculated, indexed by (r * nm + m) * nblocks + block, followed
+	// by log(rate) of the rows.
+	char *filled;
+	double *lograte;
+} BsfTable;
+
+// Quadrature rules for the integrals of the bound state rates. The Gauss-Laguerre rule has a
+// fixed order and suits the Bose distribution of GammaDiss, which decays as exp(-u), while the
+// tanh-sinh rule (double exponential) doubles its number of nodes until it converges and is
+// not affected by the logarithmic endpoint of the integrand of sigmaBSFaveraged. The rules are
+// selected with "--quadrature <simpson|laguerre|tanh-sinh>", where laguerre uses tanh-sinh for
+// sigmaBSFaveraged. All rules return diagnostics and stop at a budget of evaluations, such that
+// a pathological parameter point is reported instead of taking a long time.
+typedef enum
+{
+	QUADRATURE_SIMPSON,
+	QUADRATURE_GAUSS_LAGUERRE,
+	QUADRATURE_TANH_SINH
+} QuadratureRule;
+// The integrands are evaluated for all nodes of a panel of a rule in a single call, such that
+// the integrands can be vectorized.
+typedef void (*Integrand)(const double *u, double *out, int n, const Parameters *pars);
+#define QUADRATURE_BATCH_SIZE 64
+#define NR_QUADRATURE_RULES 3
+static const char *quadrature_names[NR_QUADRATURE_RULES] = {"simpson", "laguerre", "tanh-sinh"};
+#define QUADRATURE_EPS 1e-6
+#define QUADRATURE_MAX_EVALUATIONS 20000
+typedef struct
+{
+	// Number of integrand evaluations and estimate of the absolute error, which the Gauss-Laguerre
+	// rule takes from the rule of half its order. The depth is the deepest subdivision of Simpson's rule or the number
+	// of halvings of the step of the tanh-sinh rule.
+	long evaluations;
+	double error;
+	int depth;
+	// Set if the rule stopped at the budget, or at its order for Gauss-Laguerre, before it reached
+	// the precision.
+	bool exhausted;
+} QuadratureDiagnostics;
+// Simpson's rule keeps the right halves which remain to be integrated on a stack, one for each
+// level of subdivision.
+#define SIMPSON_MAX_DEPTH 20
+typedef struct
+{
+	double a, b;
+	double f[5];
+	int depth;
+} SimpsonInterval;
+// The Gauss-Laguerre weights include the factor exp(node), the rule falls back to tanh-sinh if
+// the integral ends before the largest node. The rule of half the order estimates the error.
+// The nodes are built once at startup.
+#define GAUSS_LAGUERRE_ORDER 64
+static double gauss_laguerre_nodes[GAUSS_LAGUERRE_ORDER];
+static double gauss_laguerre_weights[GAUSS_LAGUERRE_ORDER];
+static double gauss_laguerre_half_nodes[GAUSS_LAGUERRE_ORDER / 2];
+static double gauss_laguerre_half_weights[GAUSS_LAGUERRE_ORDER / 2];
+// The tanh-sinh nodes are placed up to TANH_SINH_TMAX, at which their distance to the endpoints
+// is below 1e-36 of the interval, and the step is halved at most TANH_SINH_MAX_LEVEL times.
+#define TANH_SINH_TMAX 4.0
+#define TANH_SINH_MAX_LEVEL 10
+
+// Arguments of the calls from micrOMEGAs to the corrections during a freeze-out run, which are
+// the distributions of (m, v) and (m, T) on which the kernels are benchmarked. The momentum in
+// the center of mass frame is set for the cross sections, T and mdm for the bound state rates.
+typedef struct
+{
+	long pdg;
+	double m, p, T, mdm;
+} BenchmarkSample;
+typedef struct
+{
+	BenchmarkSample *samples;
+	int count, capacity;
+} BenchmarkSampleList;
+typedef struct
+{
+	BenchmarkSampleList xsec, bsf;
+} BenchmarkSamples;
+// The recorded calls are thinned to these numbers of samples, and each function is timed over
+// passes of all samples for at least BENCHMARK_MIN_TIME seconds.
+#define BENCHMARK_XSEC_SAMPLES 4096
+#define BENCHMARK_BSF_SAMPLES 64
+#define BENCHMARK_SIGMA_DISS_NODES 16
+#define BENCHMARK_MIN_TIME 0.2
+// Inputs of the timed functions, which are called with the index of a sample.
+typedef struct
+{
+	const SommerfeldContext *ctx;
+	int spin, rep;
+	bool sommerfeld;
+	double alpha_s;
+	const double *m, *v, *p, *alpha_sommerfeld;
+	const BoundStateParams *bs;
+	const double *T, *mdm, *u;
+} BenchmarkInput;
+typedef double (*BenchmarkFunction)(const BenchmarkInput *input, int i);
+// Sum of the results of the timed functions, such that their calls are not optimized away.
+static volatile double benchmark_sink;
+
+// The state of the corrections for one parameter point: the flags, the particles with their
+// kernels and bound states, and the caches of the cross sections and bound state rates. The
+// functions take the context explicitly and use no other mutable state, such that independent
+// points can be evaluated concurrently with a context each. The scratch space of the integrals
+// is on the stack, and the tables of alpha strong and the quadrature nodes are built once at
+// startup and only read afterwards. The callbacks from micrOMEGAs use sommerfeld_context, as do
+// the relic density functions which call micrOMEGAs.
+struct SommerfeldContext
+{
+	// Corrections which are enabled, the cross section cache is disabled if its relative
+	// precision is zero.
+	bool sommerfeld_on, bsf_on, bsf_table_on;
+	double xsec_cache_eps;
+	QuadratureRule gamma_diss_quadrature, sigma_bsf_quadrature;
+	// The table of alpha strong for bound states if it has been read. Alpha strong of the hard
+	// process is taken from micrOMEGAs at GGscale each time a correction is calculated, or is
+	// given by the caller of the library.
+	const AlphaTable *alpha_bs_table;
+	Particle particle_registry[PARTICLE_REGISTRY_SIZE];
+	XsecCache xsec_cache[XSEC_CACHE_SIZE];
+	int xsec_cache_count;
+	BsfTable bsf_tables[BSF_TABLE_SIZE];
+	int bsf_table_count;
+	// The calls from micrOMEGAs are recorded here while the kernels are benchmarked.
+	BenchmarkSamples *benchmark_samples;
+};
+#ifndef SOMMERFELD_LIBRARY
+static SommerfeldContext sommerfeld_context;
+#endif
+
 // Bound state formation functions.
-double *alpha_table;
 double exp_cut(double x);
-void read_table_alpha(void);
-double alphaS_bs(int color, double m, double *alpha_table);
-static void r_simpson(double(*func)(double, Parameters), Parameters pars, double * f, double a, double b, double eps, double *aEps, double *ans, double *aAns, int *deepness);
-double simpsonArg( double (*func)(double, Parameters), Parameters pars, double a,double b, double  eps);
-double zeta(int color, double m);
-double zetap(int color, double m);
-double kappa(int color, double m);
-double BE(int color, double m);
-double nu(int color, double m, double z, double u);
-double bohr_radius(int color, double m);
+bool read_table_alpha(void);
+const AlphaTableHeader *map_table_alpha(const char *binary_name, size_t *size);
+bool convert_table_alpha(const char *text_name, const char *binary_name);
+double *parse_table_alpha(const char *text_name, AlphaTableHeader *header);
+double alphaS_bs(int color, double m, const AlphaTable *table);
+double alphaS_bs_tail(int color, double m);
+BoundStateParams bound_state_params(const SommerfeldContext *ctx, int spin, int color, double m, double alpha_s);
+double zeta(int color, double m, const AlphaTable *table);
+double zetap(int color, double m, const AlphaTable *table);
+double kappa(int color, double m, const AlphaTable *table);
+double BE(int color, double m, const AlphaTable *table);
+double nu(double kappa, double z, double u);
+double bohr_radius(int color, double m, const AlphaTable *table);
 int g_freedom(int spin, int color);
 double fMB(double m, double T, double vrel);
-double sigmaDiss(int spin,int color, double m, double T, double u);
-double GammaBS(int spin, int color, double m, int spin_eta);
-double GammaDissIntegrand(double u, Parameters pars);
-double GammaDiss(int spin, int color, double m, double T);
-double sigmaBSFaveraged(int spin, int color, double m, double T);
-double GammaBSaveraged(int spin, int color, double m, int spin_eta, double T);
-double bound_state_rate(int spin, int color, double m, double T);
+double sigmaDiss(const BoundStateParams *bs, double T, double u);
+double GammaBS(const BoundStateParams *bs, int spin_eta);
+void sigmaDiss_batch(const BoundStateParams *bs, double T, const double *u, double *out, int n);
+void GammaDissIntegrand_batch(const double *u, double *out, int n, const Parameters *pars);
+double GammaDiss(const SommerfeldContext *ctx, const BoundStateParams *bs, double T);
+double sigmaBSFaveraged(const SommerfeldContext *ctx, const BoundStateParams *bs, double T, double mdm);
+double GammaBSaveraged(const BoundStateParams *bs, int spin_eta, double T);
+double bound_state_rate(const SommerfeldContext *ctx, const BoundStateParams *bs, double T, double mdm);
+BoundStateRates bound_state_rates(const SommerfeldContext *ctx, const BoundStateParams *bs, double T, double mdm);
+double combine_bound_state_rates(const BoundStateParams *bs, const BoundStateRates *rates);
+
+// Bound state rate table functions.
+double improve_averaged_cross_section(SommerfeldContext *ctx, long n1, long n2, double mdm, double T);
+double bound_state_rate_tabulated(SommerfeldContext *ctx, int spin, int color, double m, double T, double mdm, double alpha_s);
+BsfTable *find_bsf_table(SommerfeldContext *ctx, int spin, int color, double alpha_s);
+void fill_bsf_table_block(const SommerfeldContext *ctx, BsfTable *table, int row, int block);
+bool read_bsf_table(BsfTable *table);
+void write_bsf_table(BsfTable *table);
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t size);
+double cubic_lagrange(const double *y, long stride, double t);
+
+// Quadrature functions.
+bool parse_quadrature(SommerfeldContext *ctx, const char *name);
+double integrate(QuadratureRule rule, Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag);
+void check_quadrature(const char *name, const Parameters *pars, const QuadratureDiagnostics *diag);
+static void r_simpson(Integrand func, const Parameters *pars, double *f, double a, double b, double eps, double *aEps, double *ans, double *aAns, QuadratureDiagnostics *diag);
+double simpsonArg(Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag);
+double gauss_laguerre(Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag);
+void build_gauss_laguerre(void);
+double tanh_sinh(Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag);
+void benchmark_quadrature(const SommerfeldContext *ctx);
+
+// Benchmark functions.
+void record_benchmark_sample(BenchmarkSampleList *list, BenchmarkSample sample);
+void thin_benchmark_samples(BenchmarkSampleList *list, int max_count);
+double wall_time(void);
+void run_benchmark(FILE *json, int *count, const char *name, BenchmarkFunction func, const BenchmarkInput *input, int n, bool kernel, double evaluations);
+double benchmark_xx_to_qq(const BenchmarkInput *input, int i);
+double benchmark_xx_to_gg(const BenchmarkInput *input, int i);
+double benchmark_alpha_strong(const BenchmarkInput *input, int i);
+double benchmark_sigma_diss(const BenchmarkInput *input, int i);
+double benchmark_gamma_diss(const BenchmarkInput *input, int i);
+double benchmark_sigma_bsf_averaged(const BenchmarkInput *input, int i);
+double benchmark_bound_state_rate(const BenchmarkInput *input, int i);
+int benchmark_kernels(SommerfeldContext *ctx, const char *output_name);
+
+// Library functions, see sommerfeld.h for the interface.
+void xsec_array(int spin, int color, bool sommerfeld, bool gluons, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *out, long n);
+void xsec_waves_array(int spin, int color, bool sommerfeld, bool gluons, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *waves, long n);
+#ifdef SOMMERFELD_LIBRARY
+// Replacements of the micrOMEGAs functions which the bound state rate uses.
+static double bessel_k0_scaled(double x);
+static double bessel_k1_scaled(double x);
+static double bessK1(double x);
+static double bessK2(double x);
+static void s_integrand_BSF_batch(const double *u, double *out, int n, const Parameters *pars);
+#endif
 
 
 /*-- Main Program --*/
 
+// The library is built without the main program, see sommerfeld.h.
+#ifndef SOMMERFELD_LIBRARY
+
 // Main part of the program.
 int main(int argc, char** argv)
 {
 	int err;
 	char cdmName[10];
 	int spin2, charge3, cdim;
+	SommerfeldContext *ctx = &sommerfeld_context;
 	ForceUG = 0;  /* to Force Unitary Gauge assign 1 */
 
 	if (argc == 1)
 	{
-		printf("Correct usage: ./main <file with parameters> <sommerfeld> <bound state formation>\n");
+		printf("Correct usage: ./main <file with parameters> <sommerfeld> <bound state formation> <cross section cache>\n");
+		printf("           or: ./main <file with parameters> --scenarios <scenarios> <cross section cache>\n");
+		printf("           or: ./main <file with parameters> --grid <mdm range> <delta range> <output file> <cross section cache>\n");
 		printf("Example: ./main data.par\n");
+		printf("Example: ./main data.par --scenarios all\n");
+		printf("Example: ./main data.par --grid 1:6001:25 0:0.25:0.005 rd_mass_delta.txt\n");
 		exit(1);
 	}
 
-	// Determine if sommerfeld corrections and bound state formation are enabled.
-	sommerfeld_on = argc >= 3 && strcmp(argv[2], "off") != 0;
-	bsf_on = argc >= 4 && strcmp(argv[3], "off") != 0;
-	printf("Sommerfeld corrections enabled: %s\n", sommerfeld_on ? "true" : "false");
-	printf("Bound state formation enabled: %s\n", bsf_on ? "true" : "false");
+	// Determine whether the bound state rate is tabulated and remove it from the arguments.
+	ctx->bsf_table_on = false;
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--bsf-table") != 0)
+			continue;
+		ctx->bsf_table_on = true;
+		for (int j = i; j + 1 <= argc; j++)
+			argv[j] = argv[j + 1];
+		argc -= 1;
+		break;
+	}
+
+	if (ctx->bsf_table_on)
+		printf("Bound state rate table enabled: true\n");
+
+	// Determine whether the quadrature rules are compared and remove it from the arguments.
+	bool quadrature_benchmark = false;
+	for (int i = 2; i < argc; i++)
+	{
+		if (strcmp(argv[i], "--quadrature-benchmark") != 0)
+			continue;
+		quadrature_benchmark = true;
+		for (int j = i; j + 1 <= argc; j++)
+			argv[j] = argv[j + 1];
+		argc -= 1;
+		break;
+	}
+
+	// Determine whether the kernels are benchmarked and remove it with the output file from the arguments.
+	const char *benchmark_name = NULL;
+	for (int i = 2; i < argc - 1; i++)
+	{
+		if (strcmp(argv[i], "--benchmark") != 0)
+			continue;
+		benchmark_name = argv[i + 1];
+		for (int j = i; j + 2 <= argc; j++)
+			argv[j] = argv[j + 2];
+		argc -= 2;
+		break;
+	}
+
+	// Determine the quadrature rule for the bound state rates and remove it from the arguments.
+	for (int i = 2; i < argc - 1; i++)
+	{
+		if (strcmp(argv[i], "--quadrature") != 0)
+			continue;
+		if (!parse_quadrature(ctx, argv[i + 1]))
+		{
+			printf("The quadrature rule must be one of: simpson laguerre tanh-sinh\n");
+			exit(1);
+		}
+		printf("Quadrature for bound state rates: %s\n", argv[i + 1]);
+		for (int j = i; j + 2 <= argc; j++)
+			argv[j] = argv[j + 2];
+		argc -= 2;
+		break;
+	}
+
+	// Determine the number of processes for a grid scan and remove it from the arguments.
+	int njobs = 1;
+	for (int i = 2; i < argc - 1; i++)
+	{
+		if (strcmp(argv[i], "--jobs") != 0)
+			continue;
+		njobs = atoi(argv[i + 1]);
+		if (njobs < 1)
+		{
+			printf("The number of jobs must be positive\n");
+			exit(1);
+		}
+		for (int j = i; j + 2 <= argc; j++)
+			argv[j] = argv[j + 2];
+		argc -= 2;
+		break;
+	}
+
+	// Determine the scenarios for which the relic density is calculated, without a list of
+	// scenarios the corrections are set on the command line and only a single one is used.
+	bool selected[NR_SCENARIOS] = {false};
+	bool scenario_mode = argc >= 3 && strcmp(argv[2], "--scenarios") == 0;
+	bool grid_mode = argc >= 3 && strcmp(argv[2], "--grid") == 0;
+	int cache_arg = grid_mode ? 6 : 4;
+	GridRange mdm_range, delta_range;
+	if (grid_mode)
+	{
+		// The grid scan calculates all scenarios for each point.
+		if (argc < 6 || !parse_grid_range(argv[3], &mdm_range) || !parse_grid_range(argv[4], &delta_range))
+		{
+			printf("Grid ranges must be given as min:max:step with a positive step and max >= min\n");
+			exit(1);
+		}
+		for (int i = 0; i < NR_SCENARIOS; i++)
+			selected[i] = true;
+		printf("Grid: %d x %d points in MDM and delta with %d jobs\n", mdm_range.npoints, delta_range.npoints, njobs);
+	}
+	else if (scenario_mode)
+	{
+		if (argc < 4 || !parse_scenarios(argv[3], selected))
+		{
+			printf("Scenarios must be \"all\" or a comma separated list of:");
+			for (int i = 0; i < NR_SCENARIOS; i++)
+				printf(" %s", scenarios[i].name);
+			printf("\n");
+			exit(1);
+		}
+		printf("Scenarios:");
+		for (int i = 0; i < NR_SCENARIOS; i++)
+			if (selected[i])
+				printf(" %s", scenarios[i].name);
+		printf("\n");
+	}
+	else
+	{
+		// Determine if sommerfeld corrections and bound state formation are enabled.
+		ctx->sommerfeld_on = argc >= 3 && strcmp(argv[2], "off") != 0;
+		ctx->bsf_on = argc >= 4 && strcmp(argv[3], "off") != 0;
+		printf("Sommerfeld corrections enabled: %s\n", ctx->sommerfeld_on ? "true" : "false");
+		printf("Bound state formation enabled: %s\n", ctx->bsf_on ? "true" : "false");
+	}
+
+	// Determine the precision of the cross section cache.
+	ctx->xsec_cache_eps = 0.0;
+	if (argc > cache_arg && strcmp(argv[cache_arg], "off") != 0)
+		ctx->xsec_cache_eps = strcmp(argv[cache_arg], "on") == 0 ? 1e-4 : atof(argv[cache_arg]);
+	if (ctx->xsec_cache_eps > 0)
+		printf("Cross section cache enabled: true (precision %.1e)\n", ctx->xsec_cache_eps);
+	else
+		printf("Cross section cache enabled: false\n");
 
 	// Read in parameter file.
 	err = readVar(argv[1]);
@@ -119,12 +892,57 @@ int main(int argc, char** argv)
 		exit(1);
 	}
 
+	// Tabulate alpha strong for the Sommerfeld corrections and the quadrature nodes, these are
+	// shared by all contexts and only read after this point.
+	build_alpha_strong_table();
+	build_gauss_laguerre();
+
+	// Read the table with alpha strong for bound states if needed, this is done before the
+	// particles are registered since the registry contains their bound states.
+	bool bsf_needed = ctx->bsf_on || quadrature_benchmark || benchmark_name != NULL;
+	for (int i = 0; i < NR_SCENARIOS; i++)
+		bsf_needed |= selected[i] && scenarios[i].bsf;
+	if (bsf_needed)
+	{
+		if (!read_table_alpha())
+			exit(10);
+		ctx->alpha_bs_table = &alpha_bs_table;
+	}
+
+	// The grid scan sets up the model for each point itself.
+	if (grid_mode)
+	{
+		err = run_grid(&mdm_range, &delta_range, argv[5], njobs);
+		free_sommerfeld_context(ctx);
+		killPlots();
+		return err;
+	}
+
 	err = sortOddParticles(cdmName);
 	if (err)
 	{
 		printf("Can't calculate %s\n", cdmName);
 		return 1;
 	}
+	build_particle_registry(ctx);
+
+	// Compare the quadrature rules for the bound states of the model.
+	if (quadrature_benchmark)
+	{
+		benchmark_quadrature(ctx);
+		free_sommerfeld_context(ctx);
+		killPlots();
+		return 0;
+	}
+
+	// Benchmark the kernels on the kinematics of a freeze-out run of the model.
+	if (benchmark_name != NULL)
+	{
+		err = benchmark_kernels(ctx, benchmark_name);
+		free_sommerfeld_context(ctx);
+		killPlots();
+		return err;
+	}
 
 	if (CDM1) 
 	{ 
@@ -146,38 +964,302 @@ int main(int argc, char** argv)
 	}
 	printMasses(stdout, 1);
 
-	// Read the table with alpha strong for bound states if needed.
-	if (bsf_on)
-		read_table_alpha();
-
 	// Calculate the relic density.
+	double Omega, OmegaFO;
+	if (!scenario_mode)
+	{
+		printf("\n==== Calculation of relic density =====\n");   
+		Omega = relic_density(&OmegaFO, true);
+		printf("omega_h^2 = %.4E\n", Omega);
+		printf("omega_h^2(FO) = %.4E\n", OmegaFO);
+		free_sommerfeld_context(ctx);
+		killPlots();
+		return 0;
+	}
+
+	// Calculate the relic density for each scenario.
+	double omega_scenario[NR_SCENARIOS];
+	relic_density_scenarios(selected, omega_scenario);
+	printf("omega_h^2(scenarios):");
+	for (int i = 0; i < NR_SCENARIOS; i++)
+		if (selected[i])
+			printf(" %s=%.4E", scenarios[i].name, omega_scenario[i]);
+	printf("\n");
+
+	free_sommerfeld_context(ctx);
+	killPlots();
+	return 0;
+}
+
+// Sets the selected scenarios from "all" or a comma separated list of scenario names.
+bool parse_scenarios(const char *list, bool *selected)
+{
+	if (strcmp(list, "all") == 0)
+	{
+		for (int i = 0; i < NR_SCENARIOS; i++)
+			selected[i] = true;
+		return true;
+	}
+	bool any = false;
+	while (*list != '\0')
+	{
+		size_t length = strcspn(list, ",");
+		bool found = false;
+		for (int i = 0; i < NR_SCENARIOS; i++)
+		{
+			if (strlen(scenarios[i].name) == length && strncmp(list, scenarios[i].name, length) == 0)
+			{
+				selected[i] = found = any = true;
+				break;
+			}
+		}
+		if (!found)
+			return false;
+		list += length;
+		if (*list == ',')
+			list++;
+	}
+	return any;
+}
+
+// Calculates the relic density with and without the freeze-out approximation.
+double relic_density(double *omega_fo, bool print_channels)
+{
 	int fast = 0;
 	double Beps = 1.E-7;
 	double cut = 0.0001;
-	double Omega, OmegaFO;
-	printf("\n==== Calculation of relic density =====\n");   
-
 	double Xf, XfFO;
-	Omega = darkOmega(&Xf, fast, Beps);
-	OmegaFO = darkOmegaFO(&XfFO, fast, Beps);
+	double Omega = darkOmega(&Xf, fast, Beps);
+	*omega_fo = darkOmegaFO(&XfFO, fast, Beps);
 
 	printf("Xf=%.4e Omega=%.4e\n", Xf, Omega);
-	printf("Xf(FO)=%.4e Omega(FO)=%.4e\n", XfFO, OmegaFO);
-	printChannels(XfFO, cut, Beps, 1, stdout);
-	printf("omega_h^2 = %.4E\n", Omega);
-	printf("omega_h^2(FO) = %.4E\n", OmegaFO);
+	printf("Xf(FO)=%.4e Omega(FO)=%.4e\n", XfFO, *omega_fo);
+	if (print_channels)
+		printChannels(XfFO, cut, Beps, 1, stdout);
+	return Omega;
+}
 
-	killPlots();
+// Calculates the relic density for the selected scenarios, the particle registry is refilled
+// with the kernels of each scenario while the cross section cache is shared by all of them.
+// The context is the one of the micrOMEGAs callbacks, since those are called by darkOmega.
+void relic_density_scenarios(const bool *selected, double *omega)
+{
+	SommerfeldContext *ctx = &sommerfeld_context;
+	double omega_fo;
+	for (int i = 0; i < NR_SCENARIOS; i++)
+	{
+		if (!selected[i])
+			continue;
+		ctx->sommerfeld_on = scenarios[i].sommerfeld;
+		ctx->bsf_on = scenarios[i].bsf;
+		build_particle_registry(ctx);
+		printf("\n==== Calculation of relic density (%s) =====\n", scenarios[i].name);
+		omega[i] = relic_density(&omega_fo, false);
+	}
+}
+
+
+/*-- Grid Scan --*/
+
+bool parse_grid_range(const char *text, GridRange *range)
+{
+	if (sscanf(text, "%lf:%lf:%lf", &range->min, &range->max, &range->step) != 3)
+		return false;
+	if (!(range->step > 0) || !(range->max >= range->min))
+		return false;
+	// Allow for rounding in the step such that the maximum is part of the grid.
+	range->npoints = (int)floor((range->max - range->min) / range->step + 1e-6) + 1;
+	return true;
+}
+
+double grid_value(const GridRange *range, int i)
+{
+	return range->min + i * range->step;
+}
+
+int run_grid(const GridRange *mdm_range, const GridRange *delta_range, const char *output_name, int njobs)
+{
+	if (assignVal("MDM", grid_value(mdm_range, 0)) != 0 || assignVal("MX", grid_value(mdm_range, 0)) != 0)
+	{
+		printf("The model has no parameters MDM and MX\n");
+		return 1;
+	}
+	GridScan scan = {*mdm_range, *delta_range, mdm_range->npoints * delta_range->npoints, 0};
+	scan.output = fopen(output_name, "w");
+	if (scan.output == NULL)
+	{
+		printf("Can not open the output file %s\n", output_name);
+		return 1;
+	}
+	fprintf(scan.output, "delta mass_dm mass_x omega omega(sommerfeld) omega(bsf) omega(sommerfeld + bsf)\n");
+	scan.results = calloc(scan.npoints, sizeof(GridResult));
+
+	// The first point is always calculated by this process, such that the processes which
+	// micrOMEGAs compiles on demand exist before the workers are forked.
+	int err = 0;
+	int first_point = njobs > 1 ? 1 : scan.npoints;
+	for (int point = 0; point < first_point && point < scan.npoints; point++)
+	{
+		GridResult result;
+		grid_point(&scan, point, &result);
+		store_grid_result(&scan, point, &result);
+	}
+	if (first_point < scan.npoints)
+		err = run_grid_workers(&scan, first_point, njobs);
+
+	fclose(scan.output);
+	free(scan.results);
+	return err;
+}
+
+int run_grid_workers(GridScan *scan, int first_point, int njobs)
+{
+	// Each worker has its own pipe for tasks, the results of all workers share one pipe.
+	// A worker gets its next point after it returned a result, which balances the load.
+	int result_pipe[2];
+	int *task_fd = malloc(njobs * sizeof(int));
+	if (pipe(result_pipe) != 0)
+	{
+		perror("Can not create the pipes for the grid workers");
+		free(task_fd);
+		return 1;
+	}
+	fflush(stdout);
+	fflush(scan->output);
+	int nworkers = 0;
+	for (; nworkers < njobs; nworkers++)
+	{
+		int task_pipe[2];
+		if (pipe(task_pipe) != 0)
+			break;
+		pid_t pid = fork();
+		if (pid < 0)
+		{
+			close(task_pipe[0]);
+			close(task_pipe[1]);
+			break;
+		}
+		if (pid == 0)
+		{
+			close(result_pipe[0]);
+			close(task_pipe[1]);
+			for (int i = 0; i < nworkers; i++)
+				close(task_fd[i]);
+			grid_worker(scan, nworkers, task_pipe[0], result_pipe[1]);
+		}
+		close(task_pipe[0]);
+		task_fd[nworkers] = task_pipe[1];
+	}
+	close(result_pipe[1]);
+	// A worker which failed must not terminate the scan when its task pipe is written.
+	signal(SIGPIPE, SIG_IGN);
+	if (nworkers < njobs)
+		printf("WARNING: only %d of %d grid workers could be started\n", nworkers, njobs);
+
+	// Hand out the points in order until all workers have been told to stop. If all workers
+	// have exited the pipe is closed, points which have not been returned are missing.
+	int next_point = first_point;
+	int nrunning = nworkers;
+	GridMessage message;
+	while (nrunning > 0 && read(result_pipe[0], &message, sizeof(message)) == sizeof(message))
+	{
+		if (message.point >= 0)
+			store_grid_result(scan, message.point, &message.result);
+		int task = next_point < scan->npoints ? next_point++ : -1;
+		if (write(task_fd[message.worker], &task, sizeof(task)) != sizeof(task) || task < 0)
+		{
+			close(task_fd[message.worker]);
+			nrunning--;
+		}
+	}
+	close(result_pipe[0]);
+	for (int i = 0; i < nworkers; i++)
+		wait(NULL);
+	free(task_fd);
+
+	if (scan->nwritten < scan->npoints)
+	{
+		printf("WARNING: grid scan stopped after %d of %d points, a worker has failed\n", scan->nwritten, scan->npoints);
+		return 1;
+	}
 	return 0;
 }
 
+// Calculates the points it receives until it is told to stop, then the process exits.
+void grid_worker(const GridScan *scan, int worker, int task_fd, int result_fd)
+{
+	GridMessage message = {worker, -1};
+	while (true)
+	{
+		if (write(result_fd, &message, sizeof(message)) != sizeof(message))
+			break;
+		int task;
+		if (read(task_fd, &task, sizeof(task)) != sizeof(task) || task < 0)
+			break;
+		message.point = task;
+		grid_point(scan, task, &message.result);
+		fflush(stdout);
+	}
+	fflush(stdout);
+	_exit(0);
+}
+
+// Calculates the relic density of all scenarios for a point of the grid scan.
+void grid_point(const GridScan *scan, int point, GridResult *result)
+{
+	bool selected[NR_SCENARIOS] = {true, true, true, true};
+	char cdmName[10];
+	double mdm = grid_value(&scan->mdm, point / scan->delta.npoints);
+	double delta = grid_value(&scan->delta, point % scan->delta.npoints);
+	printf("\n==== Grid point mdm = %.4f, delta = %.4f =====\n", mdm, delta);
+
+	// The masses are updated in place and the spectrum is recalculated.
+	*result = (GridResult){true, false};
+	assignVal("MDM", mdm);
+	assignVal("MX", mdm * (1.0 + delta));
+	if (sortOddParticles(cdmName) != 0)
+	{
+		printf("WARNING: can't calculate %s, grid point is skipped\n", cdmName);
+		return;
+	}
+	relic_density_scenarios(selected, result->omega);
+	result->valid = true;
+}
+
+// Stores the result of a point and writes all rows up to the first missing point.
+void store_grid_result(GridScan *scan, int point, const GridResult *result)
+{
+	scan->results[point] = *result;
+	for (; scan->nwritten < scan->npoints && scan->results[scan->nwritten].done; scan->nwritten++)
+	{
+		const GridResult *r = &scan->results[scan->nwritten];
+		if (!r->valid)
+			continue;
+		double mdm = grid_value(&scan->mdm, scan->nwritten / scan->delta.npoints);
+		double delta = grid_value(&scan->delta, scan->nwritten % scan->delta.npoints);
+		fprintf(scan->output, "%.4f %.4f %.4f %.4e %.4e %.4e %.4e\n", delta, mdm, mdm * (1.0 + delta), r->omega[0], r->omega[1], r->omega[2], r->omega[3]);
+	}
+	fflush(scan->output);
+}
+
+#endif
+
 
 /*-- Cross Section Improvement --*/
 
+#ifndef SOMMERFELD_LIBRARY
+
 void improveCrossSection(long n1, long n2, long n3, long n4, double pin, double *res)
+{
+	improve_cross_section(&sommerfeld_context, n1, n2, n3, n4, pin, res);
+}
+
+void improve_cross_section(SommerfeldContext *ctx, long n1, long n2, long n3, long n4, double pin, double *res)
 {
 	// Return zero for all process which do not have two colored X's.
-	if (abs(n1) < 9000000 || abs(n2) < 9000000 || color(n1) < 3 || color(n2) < 3)
+	const Particle *x1 = find_particle(ctx, n1);
+	const Particle *x2 = find_particle(ctx, n2);
+	if (x1 == NULL || x2 == NULL)
 	{
 		printf("WARNING: process %d %d -> %d %d is being ignored\n", (int)n1, (int)n2, (int)n3, (int)n4);
 		*res = 0;
@@ -185,45 +1267,31 @@ void improveCrossSection(long n1, long n2, long n3, long n4, double pin, double
 	}
 
 	// Get incoming particle masses.
-	double m1 = pMass(pdg2name(n1));
-	double m2 = pMass(pdg2name(n2));
-	double m = (m1 + m2) / 2.0;
+	double m1 = x1->mass;
+	double m2 = x2->mass;
 	if (m1 != m2)
 		printf("WARNING: masses of incoming particles are are not equal: %f and %f\n", m1, m2);
-
-	// Calculate beta and s.
-	double v = pin / sqrt(pow(pin, 2.0) + pow(m1, 2.0));
-	double s = pow(sqrt(pow(pin, 2.0) + pow(m1, 2.0)) + sqrt(pow(pin, 2.0) + pow(m2, 2.0)), 2.0);
-
-	// Calculate alpha_sommerfeld at the scale of the soft gluons.
-	double alpha_sommerfeld = alpha_strong(pin);
+	if (ctx->benchmark_samples != NULL)
+		record_benchmark_sample(&ctx->benchmark_samples->xsec, (BenchmarkSample){n1, (m1 + m2) / 2.0, pin});
 	// micrOMEGAs uses its own running for the hard process.
-	double alpha_mo = parton_alpha(GGscale);
-
-	// Determine color and spin of X.
-	long color_x = color(n1);
-	long spin_x = spin(n1);
-	if (color_x != 3 && color_x != 6 && color_x != 8)
-		printf("color of x is invalid: %d\n", (int)color_x);
-	if (spin_x < 1 || spin_x > 6)
-		printf("spin of x is invalid: %d\n", (int)spin_x);
+	double alpha_s = parton_alpha(GGscale);
 
 	// Add sommerfeld factor for XX -> qq.
 	if (abs(n1) == abs(n2) && abs(n3) >= 1 && abs(n3) <= 6 && abs(n4) >= 1 && abs(n4) <= 6)
 	{
 		double xsec_mo = *res;
-		double xsec = xx_to_qq(alpha_mo, alpha_sommerfeld, color_x, spin_x, m, v, sommerfeld_on);
+		double xsec = ctx->xsec_cache_eps > 0 ? xsec_cached(ctx, x1, x2, pin, false, alpha_s) : xsec_analytic(x1, x2, pin, false, alpha_s);
 		// Safety check: xsec is not a number.
 		if (!isfinite(xsec) || isnan(xsec))
 		{
 			printf("WARNING: xsec not a number (%e) for %d %d -> %d %d\n", xsec, (int)n1, (int)n2, (int)n3, (int)n4);
-			printf("\tmass: %f, s: %f, v: %f, p: %f, alpha_s: %f, alpha_sommerfeld: %f\n", m, sqrt(s), v, pin, alpha_mo, alpha_sommerfeld);
+			print_xsec_kinematics(m1, m2, pin, alpha_s);
 		}
 		// Safety check: micromegas vs. analytic cross section (0.1% agreement needed). 
-		if (!sommerfeld_on && fabs(1000 * (xsec - xsec_mo) / xsec_mo) > 1)
+		if (!ctx->sommerfeld_on && fabs(1000 * (xsec - xsec_mo) / xsec_mo) > 1)
 		{
 			printf("WARNING: xsec mismatch to analytic for %d %d -> %d %d\n", (int)n1, (int)n2, (int)n3, (int)n4);
-			printf("\tmass: %f, s: %f, v: %f, p: %f, alpha_s: %f, alpha_sommerfeld: %f\n", m, sqrt(s), v, pin, alpha_mo, alpha_sommerfeld);
+			print_xsec_kinematics(m1, m2, pin, alpha_s);
 			printf("\txsec(mo): %.8e, xsec(analytic): %.8e, ratio(mo/analytic): %.6f\n", xsec_mo, xsec, xsec_mo / xsec);
 		}
 		*res = xsec;
@@ -234,18 +1302,18 @@ void improveCrossSection(long n1, long n2, long n3, long n4, double pin, double
 	if (abs(n1) == abs(n2) && n3 == 21 && n4 == 21)
 	{
 		double xsec_mo = *res;
-		double xsec = xx_to_gg(alpha_mo, alpha_sommerfeld, color_x, spin_x, m, v, sommerfeld_on);
+		double xsec = ctx->xsec_cache_eps > 0 ? xsec_cached(ctx, x1, x2, pin, true, alpha_s) : xsec_analytic(x1, x2, pin, true, alpha_s);
 		// Safety check: xsec is not a number.
 		if (!isfinite(xsec) || isnan(xsec))
 		{
 			printf("WARNING: xsec not a number (%e) for %d %d -> %d %d\n", xsec, (int)n1, (int)n2, (int)n3, (int)n4);
-			printf("\tmass: %f, s: %f, v: %f, p: %f, alpha_s: %f, alpha_sommerfeld: %f\n", m, sqrt(s), v, pin, alpha_mo, alpha_sommerfeld);
+			print_xsec_kinematics(m1, m2, pin, alpha_s);
 		}
 		// Safety check: micromegas vs. analytic cross section (0.1% agreement needed). 
-		if (!sommerfeld_on && fabs(1000 * (xsec - xsec_mo) / xsec_mo) > 1)
+		if (!ctx->sommerfeld_on && fabs(1000 * (xsec - xsec_mo) / xsec_mo) > 1)
 		{
 			printf("WARNING: xsec mismatch to analytic for %d %d -> %d %d\n", (int)n1, (int)n2, (int)n3, (int)n4);
-			printf("\tmass: %f, s: %f, v: %f, p: %f, alpha_s: %f, alpha_sommerfeld: %f\n", m, sqrt(s), v, pin, alpha_mo, alpha_sommerfeld);
+			print_xsec_kinematics(m1, m2, pin, alpha_s);
 			printf("\txsec(mo): %.8e, xsec(analytic): %.8e, ratio(mo/analytic): %.6f\n", xsec_mo, xsec, xsec_mo / xsec);
 		}
 		*res = xsec;
@@ -255,7 +1323,7 @@ void improveCrossSection(long n1, long n2, long n3, long n4, double pin, double
 	// Add sommerfeld factor for X1 X2 -> (q/g) (q/g).
 	if ((n3 == 21 || (abs(n3) >= 1 && abs(n3) <= 6)) && (n4 == 21 || (abs(n4) >= 1 && abs(n4) <= 6)))
 	{
-		if (sommerfeld_on)
+		if (ctx->sommerfeld_on)
 			printf("WARNING: no Sommerfeld corrections for %d %d -> %d %d\n", (int)n1, (int)n2, (int)n3, (int)n4);
 		return;
 	}
@@ -266,110 +1334,551 @@ void improveCrossSection(long n1, long n2, long n3, long n4, double pin, double
 	return; 
 }
 
+#endif
 
-/*-- Helpers --*/
-
-long color(long pdg)
+// Analytic cross section for XX -> qq or XX -> gg, with Sommerfeld corrections if enabled.
+double xsec_analytic(const Particle *x1, const Particle *x2, double pin, bool gluons, double alpha_s)
 {
-	// The color is coded in the last two digits of the PDG number.
-	return abs(pdg) % 100;
+	XsecKernel kernel = gluons ? x1->to_gg : x1->to_qq;
+	if (kernel == NULL)
+		return 0.0;
+	double m = (x1->mass + x2->mass) / 2.0;
+	double v = pin / sqrt(pin * pin + x1->mass * x1->mass);
+	// Calculate alpha_sommerfeld at the scale of the soft gluons.
+	double alpha_sommerfeld = alpha_strong(pin);
+	return kernel(alpha_s, alpha_sommerfeld, m, v);
 }
 
-long spin(long pdg)
+// Prints the kinematics of a process for the warnings in improveCrossSection.
+void print_xsec_kinematics(double m1, double m2, double pin, double alpha_s)
 {
-	// The spin is coded in the 3rd to last digit of the PDG number.
-	return abs(pdg / 100) % 10;
+	double m = (m1 + m2) / 2.0;
+	double v = pin / sqrt(pow(pin, 2.0) + pow(m1, 2.0));
+	double s = pow(sqrt(pow(pin, 2.0) + pow(m1, 2.0)) + sqrt(pow(pin, 2.0) + pow(m2, 2.0)), 2.0);
+	printf("\tmass: %f, s: %f, v: %f, p: %f, alpha_s: %f, alpha_sommerfeld: %f\n", m, sqrt(s), v, pin, alpha_s, alpha_strong(pin));
 }
 
-double casimir2(int color)
+
+/*-- Cross Section Cache --*/
+
+double xsec_cached(SommerfeldContext *ctx, const Particle *x1, const Particle *x2, double pin, bool gluons, double alpha_s)
 {
-    switch (color)
-    {
-		case 3: return 4./3;
-		case 6: return 10./3;
-		case 8: return 3;
-		default:
-			printf("WARNING: casimir2 called with color: %d.\n", color);
-			exit(42);
-    }
+	// Find the cache for this channel, or create it if it does not exist. Particles and
+	// antiparticles share a cache, since only color, spin and masses enter the cross section.
+	// Scenarios with the same Sommerfeld corrections share a cache as well.
+	XsecCache *cache = NULL;
+	for (int i = 0; i < ctx->xsec_cache_count && i < XSEC_CACHE_SIZE; i++)
+	{
+		XsecCache *c = &ctx->xsec_cache[i];
+		if (c->gluons == gluons && c->sommerfeld == ctx->sommerfeld_on && c->x1.color == x1->color && c->x1.spin == x1->spin && c->x1.mass == x1->mass && c->x2.mass == x2->mass)
+		{
+			cache = c;
+			break;
+		}
+	}
+	if (cache == NULL)
+	{
+		// Replace the oldest cache if all are in use.
+		cache = &ctx->xsec_cache[ctx->xsec_cache_count % XSEC_CACHE_SIZE];
+		ctx->xsec_cache_count++;
+		for (int t = 0; t < cache->ntables; t++)
+		{
+			free(cache->table[t].logxsec);
+			free(cache->table[t].slope);
+		}
+		*cache = (XsecCache){*x1, *x2, gluons, ctx->sommerfeld_on};
+		build_xsec_cache(ctx, cache);
+	}
+
+	// Outside of the tables the cross section is calculated directly.
+	double logp = log(pin);
+	for (int t = 0; t < cache->ntables; t++)
+	{
+		XsecTable *table = &cache->table[t];
+		double logp_max = table->logp_min + (table->npoints - 1) * table->logp_step;
+		if (table->npoints > 0 && logp >= table->logp_min && logp <= logp_max)
+			return exp(interpolate_xsec_table(table, logp)) * pow(alpha_s, 2.0);
+	}
+	return xsec_analytic(x1, x2, pin, gluons, alpha_s);
 }
 
-double invexp(double x)
+// The tables are calculated with alpha_s = 1, which is the cross section divided by alpha_s^2.
+double xsec_cache_value(const XsecCache *cache, double logp)
 {
-	// This function is defined to prevent numerical issues for low x.	
-	return exp(x) / (exp(x) - 1);
+	return log(xsec_analytic(&cache->x1, &cache->x2, exp(logp), cache->gluons, 1.0));
 }
 
-// See the Mathematica notebook for the details of this definition of alpha_strong.
-double alpha_strong(double q)
+void build_xsec_cache(const SommerfeldContext *ctx, XsecCache *cache)
 {
-	// Implement a cut off for the momentum q of 1 GeV to not enter the non-perturbative regime.
-	q = fmax(q, 1.0);
-	// MSbar masses for the quarks.
-	double mtop = 160;
-	double mbottom = 4.18;
-	double mcharm = 1.28;
-   	// Determine number of active flavors.
-	double nf = 6.0;	
-	if (q < mcharm) nf = 3.0;
-	else if (q < mbottom) nf = 4.0;
-	else if (q < mtop) nf = 5.0;
-	// Determine the threshold lambdas.
-	double lambda = 0.08896768177299201;
-	if (q < mcharm) lambda = 0.33348050663724466;
-	else if (q < mbottom) lambda = 0.2913885366061117;
-	else if (q < mtop) lambda = 0.20953346238097081;
-	// Determine alpha_strong and return it.
-	double t = log(pow(q / lambda, 2.0));
-	double z3 = 1.202056903159594;
-	double b0 = (33.0 - 2.0 * nf) / (12.0 * M_PI);
-	double b1 = (153.0 - 19.0 * nf) / (24.0 * pow(M_PI, 2.0));
-	double b2 = (2857.0 - 5033.0 / 9.0 * nf + 325.0 / 27.0 * pow(nf, 2.0)) / (128.0 * pow(M_PI, 3.0));
-	double b3 = ((149753.0 / 6.0 + 3564.0 * z3) - (1078361.0 / 162.0 + 6508.0 / 27.0 * z3) * nf + (50065.0 / 162.0 + 6472.0 / 81.0 * z3) * pow(nf, 2.0) + 1093.0 / 729.0 * pow(nf, 3.0)) / (256.0 * pow(M_PI, 4.0));
-	return 1.0 / (b0 * t) * (1.0 - b1 / pow(b0, 2.0) * log(t) / t + (pow(b1, 2.0) * (pow(log(t), 2.0) - log(t) - 1.0) + b0 * b2) / (pow(b0, 4.0) * pow(t, 2.0)) - 1.0 / (pow(b0, 6.0) * pow(t, 3.0)) * (pow(b1, 3.0) * (pow(log(t), 3.0) - 5.0 / 2.0 * pow(log(t), 2.0) - 2.0 * log(t) + 1.0 / 2.0) + 3.0 * b0 * b1 * b2 * log(t) - 0.5 * pow(b0, 2.0) * b3));
+	// Split the range of the grid at the thresholds of alpha_strong.
+	double thresholds[] = {ALPHA_STRONG_CUTOFF, MCHARM, MBOTTOM, MTOP};
+	double m = (cache->x1.mass + cache->x2.mass) / 2.0;
+	double logp_min = log(XSEC_CACHE_PMIN * m);
+	double logp_max = log(XSEC_CACHE_PMAX * m);
+	cache->ntables = 0;
+	for (int i = 0; i < XSEC_CACHE_TABLES - 1; i++)
+	{
+		double logp_threshold = log(thresholds[i]);
+		if (logp_threshold <= logp_min || logp_threshold >= logp_max)
+			continue;
+		build_xsec_table(ctx, cache, &cache->table[cache->ntables++], logp_min, logp_threshold - XSEC_CACHE_GAP);
+		logp_min = logp_threshold + XSEC_CACHE_GAP;
+	}
+	build_xsec_table(ctx, cache, &cache->table[cache->ntables++], logp_min, logp_max);
 }
 
-
-/*-- Cross Sections --*/
-
-double xx_to_qq(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld)
+void build_xsec_table(const SommerfeldContext *ctx, const XsecCache *cache, XsecTable *table, double logp_min, double logp_max)
 {
-	if (!sommerfeld)
+	// Start with a coarse grid and halve the step size until the interpolation at the
+	// midpoints of the grid agrees with the cross section to the requested precision.
+	int npoints = XSEC_CACHE_MIN_POINTS + 1;
+	table->logp_min = logp_min;
+	table->logp_step = (logp_max - logp_min) / (npoints - 1);
+	table->logxsec = malloc(npoints * sizeof(double));
+	table->slope = NULL;
+	for (int i = 0; i < npoints; i++)
+		table->logxsec[i] = xsec_cache_value(cache, logp_min + i * table->logp_step);
+	while (true)
 	{
-		switch (spin)
+		// Tabulated cross sections must be positive and finite.
+		double *y = table->logxsec;
+		table->npoints = 0;
+		for (int i = 0; i < npoints; i++)
+			if (!isfinite(y[i]))
+				return;
+		table->npoints = npoints;
+
+		// Derivatives for a monotone piecewise cubic (Fritsch-Butland).
+		table->slope = realloc(table->slope, npoints * sizeof(double));
+		for (int i = 1; i < npoints - 1; i++)
 		{
-			case 1: case 2: return ss_to_qq(alpha_s, alpha_sommerfeld, rep, m, v);
-			case 3: case 4: return ff_to_qq(alpha_s, alpha_sommerfeld, rep, m, v);
-			case 5: case 6: return vv_to_qq(alpha_s, alpha_sommerfeld, rep, m, v);
-			default: printf("WARNING: xx_to_qq called for invalid spin %d.\n", spin); return 0.0;
+			double d1 = (y[i] - y[i - 1]) / table->logp_step;
+			double d2 = (y[i + 1] - y[i]) / table->logp_step;
+			table->slope[i] = d1 * d2 > 0 ? 2 * d1 * d2 / (d1 + d2) : 0.0;
 		}
-	}
-	else
-	{
-		switch (spin)
+		table->slope[0] = (y[1] - y[0]) / table->logp_step;
+		table->slope[npoints - 1] = (y[npoints - 1] - y[npoints - 2]) / table->logp_step;
+
+		// Compare the interpolation at the midpoints, which are also the new grid points.
+		double max_error = 0.0;
+		double *refined = malloc((2 * npoints - 1) * sizeof(double));
+		for (int i = 0; i < npoints - 1; i++)
 		{
-			case 1: case 2: return ss_to_qq_sommerfeld(alpha_s, alpha_sommerfeld, rep, m, v);
-			case 3: case 4: return ff_to_qq_sommerfeld(alpha_s, alpha_sommerfeld, rep, m, v);
-			case 5: case 6: return vv_to_qq_sommerfeld(alpha_s, alpha_sommerfeld, rep, m, v);
-			default: printf("WARNING: xx_to_qq called for invalid spin %d.\n", spin); return 0.0;
+			double logp = table->logp_min + (i + 0.5) * table->logp_step;
+			refined[2 * i] = y[i];
+			refined[2 * i + 1] = xsec_cache_value(cache, logp);
+			max_error = fmax(max_error, fabs(expm1(interpolate_xsec_table(table, logp) - refined[2 * i + 1])));
+		}
+		refined[2 * npoints - 2] = y[npoints - 1];
+		// The error at the midpoints underestimates the maximal error in between.
+		if (max_error <= ctx->xsec_cache_eps / 4 || 2 * npoints - 1 > XSEC_CACHE_MAX_POINTS + 1)
+		{
+			if (max_error > ctx->xsec_cache_eps / 4)
+				printf("WARNING: cross section cache has precision %.1e instead of %.1e\n", 4 * max_error, ctx->xsec_cache_eps);
+			free(refined);
+			return;
 		}
+		free(table->logxsec);
+		table->logxsec = refined;
+		table->logp_step /= 2;
+		npoints = 2 * npoints - 1;
 	}
-	return 0.0;
 }
 
-double xx_to_gg(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld)
+double interpolate_xsec_table(const XsecTable *table, double logp)
 {
-	if (!sommerfeld)
+	double x = (logp - table->logp_min) / table->logp_step;
+	int i = (int)x;
+	if (i > table->npoints - 2)
+		i = table->npoints - 2;
+	double t = x - i;
+	double t2 = t * t;
+	double t3 = t2 * t;
+	// Cubic Hermite polynomial on the interval [i, i + 1].
+	double y0 = table->logxsec[i], y1 = table->logxsec[i + 1];
+	double d0 = table->slope[i] * table->logp_step, d1 = table->slope[i + 1] * table->logp_step;
+	return (2 * t3 - 3 * t2 + 1) * y0 + (t3 - 2 * t2 + t) * d0 + (3 * t2 - 2 * t3) * y1 + (t3 - t2) * d1;
+}
+
+/*-- Sommerfeld Context --*/
+
+// Frees the tables of the cross section and bound state rate caches, the context can be used
+// again afterwards with empty caches.
+void free_sommerfeld_context(SommerfeldContext *ctx)
+{
+	for (int i = 0; i < XSEC_CACHE_SIZE; i++)
 	{
-		switch (spin)
+		for (int t = 0; t < ctx->xsec_cache[i].ntables; t++)
 		{
-			case 1: case 2: return ss_to_gg(alpha_s, alpha_sommerfeld, rep, m, v);
-			case 3: case 4: return ff_to_gg(alpha_s, alpha_sommerfeld, rep, m, v);
-			case 5: case 6: return vv_to_gg(alpha_s, alpha_sommerfeld, rep, m, v);
-			default: printf("WARNING: gg_to_qq called for invalid spin %d.\n", spin); return 0.0;
+			free(ctx->xsec_cache[i].table[t].logxsec);
+			free(ctx->xsec_cache[i].table[t].slope);
 		}
+		ctx->xsec_cache[i].ntables = 0;
 	}
-	else
+	ctx->xsec_cache_count = 0;
+	for (int i = 0; i < BSF_TABLE_SIZE; i++)
+	{
+		free(ctx->bsf_tables[i].filled);
+		free(ctx->bsf_tables[i].lograte);
+		ctx->bsf_tables[i] = (BsfTable){0};
+	}
+	ctx->bsf_table_count = 0;
+}
+
+/*-- Particle Registry --*/
+
+#ifndef SOMMERFELD_LIBRARY
+
+void build_particle_registry(SommerfeldContext *ctx)
+{
+	// The masses change with the parameters, so the registry is filled from scratch.
+	memset(ctx->particle_registry, 0, sizeof(ctx->particle_registry));
+	// Register all colored X's, X is its own antiparticle if name and aname are equal.
+	for (int i = 0; i < nModelParticles; i++)
+	{
+		long pdg = ModelPrtcls[i].NPDG;
+		if (abs(pdg) < 9000000 || color(pdg) < 3)
+			continue;
+		double mass = pMass(ModelPrtcls[i].name);
+		register_particle(ctx, pdg, mass);
+		if (strcmp(ModelPrtcls[i].name, ModelPrtcls[i].aname) != 0)
+			register_particle(ctx, -pdg, mass);
+	}
+}
+
+#endif
+
+void register_particle(SommerfeldContext *ctx, long pdg, double mass)
+{
+	long color_x = color(pdg);
+	long spin_x = spin(pdg);
+	if (color_x != 3 && color_x != 6 && color_x != 8)
+	{
+		printf("WARNING: color of %d is invalid: %d\n", (int)pdg, (int)color_x);
+		return;
+	}
+
+	// Probe from the hash of the PDG code up to the first empty slot.
+	uint64_t hash = ((uint64_t)pdg * 0x9E3779B97F4A7C15ULL) >> (64 - PARTICLE_REGISTRY_BITS);
+	for (int i = 0; i < PARTICLE_REGISTRY_SIZE; i++)
+	{
+		Particle *x = &ctx->particle_registry[(hash + i) % PARTICLE_REGISTRY_SIZE];
+		if (x->pdg != 0 && x->pdg != pdg)
+			continue;
+		*x = (Particle){pdg, mass, color_x, spin_x, casimir2(color_x)};
+		x->to_qq = xsec_kernel(spin_x, color_x, ctx->sommerfeld_on, false);
+		x->to_gg = xsec_kernel(spin_x, color_x, ctx->sommerfeld_on, true);
+		// Alpha strong of the hard process is set when the bound state is used.
+		if (ctx->alpha_bs_table != NULL)
+			x->bound_state = bound_state_params(ctx, spin_x, color_x, mass, NAN);
+		return;
+	}
+	printf("WARNING: particle registry is full, %d is not registered\n", (int)pdg);
+}
+
+const Particle *find_particle(const SommerfeldContext *ctx, long pdg)
+{
+	uint64_t hash = ((uint64_t)pdg * 0x9E3779B97F4A7C15ULL) >> (64 - PARTICLE_REGISTRY_BITS);
+	for (int i = 0; i < PARTICLE_REGISTRY_SIZE; i++)
+	{
+		const Particle *x = &ctx->particle_registry[(hash + i) % PARTICLE_REGISTRY_SIZE];
+		if (x->pdg == pdg)
+			return x;
+		if (x->pdg == 0)
+			return NULL;
+	}
+	return NULL;
+}
+
+XsecKernel xsec_kernel(long spin, long color, bool sommerfeld, bool gluons)
+{
+	// Kernel resolvers indexed by Sommerfeld corrections, final state and spin.
+	static XsecKernel (*const resolvers[2][2][3])(int rep) = {
+		{{ss_to_qq_kernel, ff_to_qq_kernel, vv_to_qq_kernel}, {ss_to_gg_kernel, ff_to_gg_kernel, vv_to_gg_kernel}},
+		{{ss_to_qq_sommerfeld_kernel, ff_to_qq_sommerfeld_kernel, vv_to_qq_sommerfeld_kernel}, {ss_to_gg_sommerfeld_kernel, ff_to_gg_sommerfeld_kernel, vv_to_gg_sommerfeld_kernel}}
+	};
+	if (spin < 1 || spin > 6)
+	{
+		printf("WARNING: xsec_kernel called for invalid spin %d.\n", (int)spin);
+		return NULL;
+	}
+	return resolvers[sommerfeld][gluons][(spin - 1) / 2](color);
+}
+
+/*-- Helpers --*/
+
+long color(long pdg)
+{
+	// The color is coded in the last two digits of the PDG number.
+	return abs(pdg) % 100;
+}
+
+long spin(long pdg)
+{
+	// The spin is coded in the 3rd to last digit of the PDG number.
+	return abs(pdg / 100) % 10;
+}
+
+double casimir2(int color)
+{
+    switch (color)
+    {
+		case 3: return 4./3;
+		case 6: return 10./3;
+		case 8: return 3;
+		default:
+			printf("WARNING: casimir2 called with color: %d.\n", color);
+			exit(42);
+    }
+}
+
+double invexp(double x)
+{
+	// This function is defined to prevent numerical issues for low x.	
+	return exp(x) / (exp(x) - 1);
+}
+
+// Exponential which the compiler can vectorize in the batch cross sections, it agrees
+// with exp up to a few ulp over the full range including subnormal results.
+BATCH_OPTIMIZE static inline double exp_simd(double x)
+{
+	// Split x = k * log(2) + r with |r| <= log(2) / 2, the shift rounds k to an integer.
+	double shift = 0x1.8p52;
+	double kd = x * M_LOG2E + shift;
+	uint64_t kbits;
+	memcpy(&kbits, &kd, sizeof(kd));
+	kd -= shift;
+	double r = (x - kd * 0x1.62e42fee00000p-1) - kd * 0x1.a39ef35793c76p-33;
+	// Taylor series of exp(r) up to r^13, which is accurate to double precision.
+	double p = 1.0 / 6227020800.0;
+	p = p * r + 1.0 / 479001600.0;
+	p = p * r + 1.0 / 39916800.0;
+	p = p * r + 1.0 / 3628800.0;
+	p = p * r + 1.0 / 362880.0;
+	p = p * r + 1.0 / 40320.0;
+	p = p * r + 1.0 / 5040.0;
+	p = p * r + 1.0 / 720.0;
+	p = p * r + 1.0 / 120.0;
+	p = p * r + 1.0 / 24.0;
+	p = p * r + 1.0 / 6.0;
+	p = p * r + 0.5;
+	p = p * r + 1.0;
+	p = p * r + 1.0;
+	// The mantissa of kd contains 2^51 + k, 2^k is built from two factors 2^(k / 2) such
+	// that subnormal results are possible. Out of range arguments are handled with bit
+	// masks instead of branches to allow vectorization.
+	uint64_t k = kbits & ((UINT64_C(1) << 52) - 1);
+	uint64_t k1 = k >> 1;
+	uint64_t underflow = -(uint64_t)(x < -745.2);
+	uint64_t overflow = -(uint64_t)(x > 709.8);
+	uint64_t scale1_bits = ((k1 + 1023) << 52) & ~underflow & ~overflow;
+	uint64_t scale2_bits = ((k - k1 + 1023) << 52) & ~underflow & ~overflow;
+	scale1_bits |= UINT64_C(0x7ff0000000000000) & overflow;
+	scale2_bits |= UINT64_C(0x7ff0000000000000) & overflow;
+	double scale1, scale2;
+	memcpy(&scale1, &scale1_bits, sizeof(scale1));
+	memcpy(&scale2, &scale2_bits, sizeof(scale2));
+	return p * scale1 * scale2;
+}
+
+BATCH_OPTIMIZE static inline double invexp_simd(double x)
+{
+	double e = exp_simd(x);
+	return e / (e - 1);
+}
+
+// Square root which the compiler can vectorize in the batch cross sections, sqrt itself
+// prevents vectorization since it may set errno. Valid for non-negative x and accurate
+// up to an ulp.
+BATCH_OPTIMIZE static inline double sqrt_simd(double x)
+{
+	// Initial estimate of 1 / sqrt(x) from the bit pattern, refined with Newton iterations.
+	uint64_t bits;
+	memcpy(&bits, &x, sizeof(x));
+	bits = UINT64_C(0x5fe6eb50c7b537a9) - (bits >> 1);
+	double y;
+	memcpy(&y, &bits, sizeof(y));
+	y = y * (1.5 - 0.5 * x * y * y);
+	y = y * (1.5 - 0.5 * x * y * y);
+	y = y * (1.5 - 0.5 * x * y * y);
+	y = y * (1.5 - 0.5 * x * y * y);
+	// Final Newton step on the square root itself.
+	double s = x * y;
+	return s + 0.5 * y * (x - s * s);
+}
+
+// Version of exp_cut which the compiler can vectorize in the bound state integrands.
+BATCH_OPTIMIZE static inline double exp_cut_simd(double x)
+{
+	return x < -50 ? 0 : exp_simd(x);
+}
+
+// Arc tangent which the compiler can vectorize in the bound state integrands, accurate up to
+// a few ulp. This is the rational approximation of the Cephes library where the argument is
+// reduced to |x| <= tan(pi / 8) with selects instead of branches.
+BATCH_OPTIMIZE static inline double atan_simd(double x)
+{
+	double sign = x < 0 ? -1.0 : 1.0;
+	x = fabs(x);
+	bool large = x > 2.414213562373095;
+	bool medium = x > 0.66;
+	double offset = large ? M_PI / 2 : medium ? M_PI / 4 : 0.0;
+	double more_bits = large ? 6.123233995736765886130e-17 : medium ? 0.5 * 6.123233995736765886130e-17 : 0.0;
+	double reduced = large ? -1.0 / x : medium ? (x - 1.0) / (x + 1.0) : x;
+	double z = reduced * reduced;
+	double p = -8.750608600031904122785e-1;
+	p = p * z - 1.615753718733365076637e1;
+	p = p * z - 7.500855792314704667340e1;
+	p = p * z - 1.228866684490136173410e2;
+	p = p * z - 6.485021904942025371773e1;
+	double q = z + 2.485846490142306297962e1;
+	q = q * z + 1.650270098316988542046e2;
+	q = q * z + 4.328810604912902668951e2;
+	q = q * z + 4.853903996359136964868e2;
+	q = q * z + 1.945506571482613964425e2;
+	return sign * (offset + (reduced + reduced * z * p / q + more_bits));
+}
+
+double alpha_strong(double q)
+{
+#ifdef ALPHA_STRONG_SERIES
+	q = fmax(q, ALPHA_STRONG_CUTOFF);
+	if (q < ALPHA_STRONG_QMAX)
+	{
+		const ChebyshevSeries *series = &alpha_strong_series[q < MCHARM ? 0 : q < MBOTTOM ? 1 : q < MTOP ? 2 : 3];
+		if (series->degree > 0)
+			return 1.0 / evaluate_chebyshev(series, log(q));
+	}
+#endif
+	return alpha_strong_exact(q);
+}
+
+// See the Mathematica notebook for the details of this definition of alpha_strong.
+double alpha_strong_exact(double q)
+{
+	// Implement a cut off for the momentum q of 1 GeV to not enter the non-perturbative regime.
+	q = fmax(q, ALPHA_STRONG_CUTOFF);
+	// Determine the number of active flavors and the threshold lambda.
+	const AlphaStrongCoefficients *c = &alpha_strong_coefficients[q < MCHARM ? 0 : q < MBOTTOM ? 1 : q < MTOP ? 2 : 3];
+	// Determine alpha_strong and return it.
+	double t = 2.0 * log(q / c->lambda);
+	double l = log(t);
+	double x = 1.0 / t;
+	return c->inv_b0 * x * (1.0 - c->c1 * l * x + (c->c2 * (l * l - l - 1.0) + c->c2b) * x * x - (c->c3 * (l * (l * (l - 2.5) - 2.0) + 0.5) + c->c3b * l - c->c3c) * x * x * x);
+}
+
+
+void build_alpha_strong_table(void)
+{
+#ifdef ALPHA_STRONG_SERIES
+	// Fit each flavor region with the lowest degree which reaches the required precision.
+	double thresholds[] = {ALPHA_STRONG_CUTOFF, MCHARM, MBOTTOM, MTOP, ALPHA_STRONG_QMAX};
+	double max_error = 0.0;
+	for (int region = 0; region < 4; region++)
+	{
+		ChebyshevSeries *series = &alpha_strong_series[region];
+		double error = INFINITY;
+		for (int degree = 8; degree <= ALPHA_STRONG_MAX_DEGREE && !(error <= ALPHA_STRONG_EPS); degree *= 2)
+			error = fit_alpha_strong(series, thresholds[region], thresholds[region + 1], degree);
+		if (!(error <= ALPHA_STRONG_EPS))
+		{
+			printf("WARNING: alpha_strong has precision %.1e between %.2f and %.2f, using the exact formula\n", error, thresholds[region], thresholds[region + 1]);
+			series->degree = 0;
+			continue;
+		}
+		max_error = fmax(max_error, error);
+	}
+	printf("alpha_strong tabulated: true (precision %.1e)\n", max_error);
+#endif
+}
+
+#ifdef ALPHA_STRONG_SERIES
+double fit_alpha_strong(ChebyshevSeries *series, double q_min, double q_max, int degree)
+{
+	// Chebyshev coefficients of 1 / alpha_strong from its values at the Chebyshev nodes.
+	series->logq_min = log(q_min);
+	series->logq_max = log(q_max);
+	double center = (series->logq_max + series->logq_min) / 2.0;
+	double half_width = (series->logq_max - series->logq_min) / 2.0;
+	double f[ALPHA_STRONG_MAX_DEGREE];
+	for (int k = 0; k < degree; k++)
+		f[k] = 1.0 / alpha_strong_exact(exp(center + half_width * cos(M_PI * (k + 0.5) / degree)));
+	series->degree = degree;
+	for (int j = 0; j < degree; j++)
+	{
+		double sum = 0.0;
+		for (int k = 0; k < degree; k++)
+			sum += f[k] * cos(M_PI * j * (k + 0.5) / degree);
+		series->coefficient[j] = 2.0 * sum / degree;
+	}
+
+	// Maximal relative error on a grid which includes both ends of the region, the momenta
+	// are kept inside of the region such that the exact formula uses the same flavors.
+	double max_error = 0.0;
+	for (int i = 0; i <= ALPHA_STRONG_CHECKS; i++)
+	{
+		double q = exp(series->logq_min + (series->logq_max - series->logq_min) * i / ALPHA_STRONG_CHECKS);
+		q = fmin(fmax(q, q_min), nextafter(q_max, 0.0));
+		max_error = fmax(max_error, fabs(alpha_strong_exact(q) * evaluate_chebyshev(series, log(q)) - 1.0));
+	}
+	return max_error;
+}
+
+// Evaluates a Chebyshev series with the Clenshaw recurrence.
+double evaluate_chebyshev(const ChebyshevSeries *series, double x)
+{
+	double u = (2.0 * x - series->logq_min - series->logq_max) / (series->logq_max - series->logq_min);
+	double b1 = 0.0, b2 = 0.0;
+	for (int j = series->degree - 1; j > 0; j--)
+	{
+		double b0 = 2.0 * u * b1 - b2 + series->coefficient[j];
+		b2 = b1;
+		b1 = b0;
+	}
+	return u * b1 - b2 + 0.5 * series->coefficient[0];
+}
+#endif
+
+/*-- Cross Sections --*/
+
+double xx_to_qq(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld)
+{
+	if (!sommerfeld)
+	{
+		switch (spin)
+		{
+			case 1: case 2: return ss_to_qq(alpha_s, alpha_sommerfeld, rep, m, v);
+			case 3: case 4: return ff_to_qq(alpha_s, alpha_sommerfeld, rep, m, v);
+			case 5: case 6: return vv_to_qq(alpha_s, alpha_sommerfeld, rep, m, v);
+			default: printf("WARNING: xx_to_qq called for invalid spin %d.\n", spin); return 0.0;
+		}
+	}
+	else
+	{
+		switch (spin)
+		{
+			case 1: case 2: return ss_to_qq_sommerfeld(alpha_s, alpha_sommerfeld, rep, m, v);
+			case 3: case 4: return ff_to_qq_sommerfeld(alpha_s, alpha_sommerfeld, rep, m, v);
+			case 5: case 6: return vv_to_qq_sommerfeld(alpha_s, alpha_sommerfeld, rep, m, v);
+			default: printf("WARNING: xx_to_qq called for invalid spin %d.\n", spin); return 0.0;
+		}
+	}
+	return 0.0;
+}
+
+double xx_to_gg(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld)
+{
+	if (!sommerfeld)
+	{
+		switch (spin)
+		{
+			case 1: case 2: return ss_to_gg(alpha_s, alpha_sommerfeld, rep, m, v);
+			case 3: case 4: return ff_to_gg(alpha_s, alpha_sommerfeld, rep, m, v);
+			case 5: case 6: return vv_to_gg(alpha_s, alpha_sommerfeld, rep, m, v);
+			default: printf("WARNING: gg_to_qq called for invalid spin %d.\n", spin); return 0.0;
+		}
+	}
+	else
 	{
 		switch (spin)
 		{
@@ -382,6 +1891,115 @@ double xx_to_gg(double alpha_s, double alpha_sommerfeld, int rep, int spin, doub
 	return 0.0;
 }
 
+void xx_to_qq_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, int spin, double m, const double *v, bool sommerfeld, double *out, int n)
+{
+	if (!sommerfeld)
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_qq_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 3: case 4: ff_to_qq_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 5: case 6: vv_to_qq_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+		}
+	}
+	else
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_qq_sommerfeld_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 3: case 4: ff_to_qq_sommerfeld_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 5: case 6: vv_to_qq_sommerfeld_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+		}
+	}
+	printf("WARNING: xx_to_qq_batch called for invalid spin %d.\n", spin);
+	for (int i = 0; i < n; i++)
+		out[i] = 0.0;
+}
+
+void xx_to_gg_batch(const double *alpha_s, const double *alpha_sommerfeld, int rep, int spin, double m, const double *v, bool sommerfeld, double *out, int n)
+{
+	if (!sommerfeld)
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_gg_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 3: case 4: ff_to_gg_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 5: case 6: vv_to_gg_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+		}
+	}
+	else
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_gg_sommerfeld_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 3: case 4: ff_to_gg_sommerfeld_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+			case 5: case 6: vv_to_gg_sommerfeld_batch(alpha_s, alpha_sommerfeld, rep, m, v, out, n); return;
+		}
+	}
+	printf("WARNING: xx_to_gg_batch called for invalid spin %d.\n", spin);
+	for (int i = 0; i < n; i++)
+		out[i] = 0.0;
+}
+
+void xx_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld, double *waves)
+{
+	if (!sommerfeld)
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_qq_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 3: case 4: ff_to_qq_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 5: case 6: vv_to_qq_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+		}
+	}
+	else
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_qq_sommerfeld_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 3: case 4: ff_to_qq_sommerfeld_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 5: case 6: vv_to_qq_sommerfeld_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+		}
+	}
+	printf("WARNING: xx_to_qq_waves called for invalid spin %d.\n", spin);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
+
+void xx_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, int spin, double m, double v, bool sommerfeld, double *waves)
+{
+	if (!sommerfeld)
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_gg_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 3: case 4: ff_to_gg_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 5: case 6: vv_to_gg_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+		}
+	}
+	else
+	{
+		switch (spin)
+		{
+			case 1: case 2: ss_to_gg_sommerfeld_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 3: case 4: ff_to_gg_sommerfeld_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+			case 5: case 6: vv_to_gg_sommerfeld_waves(alpha_s, alpha_sommerfeld, rep, m, v, waves); return;
+		}
+	}
+	printf("WARNING: xx_to_gg_waves called for invalid spin %d.\n", spin);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
+
+// Sum of the partial waves up to l, which is truncated to the partial waves which exist.
+double sum_partial_waves(const double *waves, int l)
+{
+	double xsec = 0.0;
+	for (int i = 0; i <= l && i < NR_PARTIAL_WAVES; i++)
+		xsec += waves[i];
+	return xsec;
+}
+
 double ss_to_qq(double alpha_s, double alpha_sommerfeld, int rep, double m, double v)
 {
 	switch (rep)
@@ -526,213 +2144,691 @@ double vv_to_gg_sommerfeld(double alpha_s, double alpha_sommerfeld, int rep, dou
 	return 0.0;
 }
 
-
-/*-- Improve Averaged Cross Section --*/
-
-double improveAveragedCrossSection(long n1, long n2, double mdm, double T)
+// The specialized partial wave kernels are added by kernel_codegen.py from sommerfeld.py.
+void ss_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
 {
-	if (!bsf_on)
-		return 0.0;
-
-	// Return zero for all process which do not have two equal colored X's.
-	if (abs(n1) < 9000000 || abs(n2) < 9000000 || abs(n1) != abs(n2))
+	switch (rep)
 	{
-		printf("WARNING: bound state corrections for process %d %d -> ??? are being ignored\n", (int)n1, (int)n2);
-		return 0.0;	
+		case 3: ss_to_qq_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ss_to_qq_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ss_to_qq_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
 	}
+	printf("WARNING: ss_to_qq_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
 
-	// Get incoming particle masses.
-	double m1 = pMass(pdg2name(n1));
-	double m2 = pMass(pdg2name(n2));
-	double m = (m1 + m2) / 2.0;
-	if (m1 != m2)
-		printf("WARNING: masses of incoming particles are are not equal: %f and %f", m1, m2);
-
-	// Determine color and spin of X.
-	long color_x = color(n1);
-	long spin_x = spin(n1);
-
-	// Calculate the bound state formation rate.
-	double bsf_rate = bound_state_rate(spin_x, color_x, m, T);
-	// Safety check: bound state formation rate is not a number.
-	if (!isfinite(bsf_rate) || isnan(bsf_rate))
+void ff_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
 	{
-		printf("WARNING: averaged BSF rate is not a number (%e) for %d %d -> ??? \n", bsf_rate, (int)n1, (int)n2);
-		printf("\tmass: %f, T: %f\n", m, T);
+		case 3: ff_to_qq_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ff_to_qq_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ff_to_qq_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
 	}
-	return bsf_rate;
+	printf("WARNING: ff_to_qq_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
 }
 
-
-/*-- Bound State Formation --*/
-
-// Helper function to compute an exponential without underflowing.
-double exp_cut(double x)
+void vv_to_qq_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
 {
-	if (x < -50)
-		return 0;
-	return exp(x);
+	switch (rep)
+	{
+		case 3: vv_to_qq_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: vv_to_qq_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: vv_to_qq_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: vv_to_qq_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
 }
 
-void read_table_alpha(void)
+void ss_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
 {
-	// The table that is being read has 2001 times 3 entries.
-	int nr_entries = 2001;
-	alpha_table = (double*) calloc(3 * nr_entries, sizeof(double));
-	FILE * falpha = fopen("alpha_strong_bsf.txt", "r");
-	int m;
-	int counter = 0;
-	while (!feof(falpha))
+	switch (rep)
 	{
-		if (counter/3 > nr_entries)
-		{
-			printf("Size of alpha table greater than N=%d\n", nr_entries);
-			exit(10);
-		}
-		fscanf(falpha, "%d %lf %lf %lf\n", &m, &(alpha_table[counter]), &(alpha_table[counter + 1]), &(alpha_table[counter + 2]));
-		counter += 3;
+		case 3: ss_to_gg_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ss_to_gg_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ss_to_gg_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
 	}
-	if (falpha == NULL)
-		perror("The folloriwng error occured");
-	//fclose(falpha);
-	return;
-} 
+	printf("WARNING: ss_to_gg_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
 
-// Alpha strong for the bound state formation is determined from a recursive formula in Mathermatica and is read in from a table.
-double alphaS_bs(int color, double m, double *alpha_table)
+void ff_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
 {
-	// Min, max and step size of the table.
-	int mmin = 0, mmax = 20000, mstep = 10;
-	int color_index;
-	if (color == 3) color_index = 0;
-	if (color == 6) color_index = 1;
-	if (color == 8) color_index = 2;
-	int mbin = (int) floor((m - mmin) / mstep + 0.001);
-	return alpha_table[mbin * 3 + color_index];
+	switch (rep)
+	{
+		case 3: ff_to_gg_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ff_to_gg_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ff_to_gg_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: ff_to_gg_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
 }
 
-// Integration method from micrOMEGAs.
-static void r_simpson(double(*func)(double, Parameters), Parameters pars, double *f, double a, double b, double eps, double *aEps, double *ans, double *aAns, int *deepness)
+void vv_to_gg_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
 {
-	double f1[5];
-	int i;
-	int d1 = *deepness + 1, d2 = *deepness + 1;
-	double s1, s2, s3, e_err;
+	switch (rep)
+	{
+		case 3: vv_to_gg_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: vv_to_gg_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: vv_to_gg_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: vv_to_gg_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
 
-	s1 = (f[0] + 4 * f[4] + f[8])/6;
-	s2 = (f[0] + 4 * f[2] + 2 * f[4] + 4 * f[6] + f[8]) / 12;
-	s3 = (f[0] + 4 * f[1] + 2 * f[2] + 4 * f[3] + 2 * f[4] + 4 * f[5] + 2 * f[6] + 4 * f[7] + f[8]) / 24;
+void ss_to_qq_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
+	{
+		case 3: ss_to_qq_sommerfeld_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ss_to_qq_sommerfeld_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ss_to_qq_sommerfeld_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: ss_to_qq_sommerfeld_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
 
-	if (!isfinite(s3))
+void ff_to_qq_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
 	{
-		*ans = s3;
-		*aAns = s3;
-		return;
+		case 3: ff_to_qq_sommerfeld_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ff_to_qq_sommerfeld_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ff_to_qq_sommerfeld_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
 	}
+	printf("WARNING: ff_to_qq_sommerfeld_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
 
-	e_err = eps * fabs(s3);
-	i = 0;
-	if ((fabs(s3 - s2) < e_err && fabs(s3 - s1) < 16 * e_err))
-		i = 1;
-	else if (fabs(s3 - s2) * (b - a) < 0.1 * (*aEps) && fabs(s3 - s1) * (b - a) < 1.6 * (*aEps)) 
+void vv_to_qq_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
 	{
-		i = 1;
-		*aEps -= fabs((s3 - s2) * (b - a));
+		case 3: vv_to_qq_sommerfeld_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: vv_to_qq_sommerfeld_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: vv_to_qq_sommerfeld_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
 	}
+	printf("WARNING: vv_to_qq_sommerfeld_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
 
-	if (i || *deepness > 20)
+void ss_to_gg_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
 	{
-		*ans += s3 * (b - a);
-		*aAns += (fabs(f[0]) + 4 * fabs(f[2]) + 2 * fabs(f[4]) + 4 * fabs(f[6]) + fabs(f[8])) * fabs(b - a) / 12;
-		return;
+		case 3: ss_to_gg_sommerfeld_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ss_to_gg_sommerfeld_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ss_to_gg_sommerfeld_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: ss_to_gg_sommerfeld_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
+
+void ff_to_gg_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
+	{
+		case 3: ff_to_gg_sommerfeld_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: ff_to_gg_sommerfeld_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: ff_to_gg_sommerfeld_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: ff_to_gg_sommerfeld_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
+
+void vv_to_gg_sommerfeld_waves(double alpha_s, double alpha_sommerfeld, int rep, double m, double v, double *waves)
+{
+	switch (rep)
+	{
+		case 3: vv_to_gg_sommerfeld_waves_rep3(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 6: vv_to_gg_sommerfeld_waves_rep6(alpha_s, alpha_sommerfeld, m, v, waves); return;
+		case 8: vv_to_gg_sommerfeld_waves_rep8(alpha_s, alpha_sommerfeld, m, v, waves); return;
+	}
+	printf("WARNING: vv_to_gg_sommerfeld_waves called for invalid representation %d.\n", rep);
+	for (int l = 0; l < NR_PARTIAL_WAVES; l++)
+		waves[l] = 0.0;
+}
+
+
+/*-- Improve Averaged Cross Section --*/
+
+#ifndef SOMMERFELD_LIBRARY
+
+double improveAveragedCrossSection(long n1, long n2, double mdm, double T)
+{
+	return improve_averaged_cross_section(&sommerfeld_context, n1, n2, mdm, T);
+}
+
+double improve_averaged_cross_section(SommerfeldContext *ctx, long n1, long n2, double mdm, double T)
+{
+	if (!ctx->bsf_on)
+		return 0.0;
+
+	// Return zero for all process which do not have two equal colored X's.
+	const Particle *x1 = find_particle(ctx, n1);
+	const Particle *x2 = find_particle(ctx, n2);
+	if (x1 == NULL || x2 == NULL || abs(n1) != abs(n2))
+	{
+		printf("WARNING: bound state corrections for process %d %d -> ??? are being ignored\n", (int)n1, (int)n2);
+		return 0.0;	
 	}
 
-	for (i = 0; i < 5; i++)
-		f1[i] = f[4 + i];
-	for (i = 8; i > 0; i -= 2)
-		f[i] = f[i / 2];
-	for (i = 1; i < 8; i += 2)
-		f[i] = (*func)(a + i * (b - a) / 16, pars);
-
-	r_simpson(func, pars, f, a, (a + b) / 2, eps, aEps, ans, aAns, &d1);
-	for (i = 0; i < 5; i++)
-		f[2 * i] = f1[i];
-	for (i = 1; i < 8; i+= 2)
-		f[i] = (*func)((a + b) / 2 + i * (b - a) / 16, pars);
-	r_simpson(func, pars, f, (a + b) / 2, b, eps, aEps, ans, aAns, &d2);
-	if (d1 > d2)
-		*deepness = d1;
+	// Get incoming particle masses.
+	double m1 = x1->mass;
+	double m2 = x2->mass;
+	double m = (m1 + m2) / 2.0;
+	if (m1 != m2)
+		printf("WARNING: masses of incoming particles are are not equal: %f and %f", m1, m2);
+	if (ctx->benchmark_samples != NULL)
+		record_benchmark_sample(&ctx->benchmark_samples->bsf, (BenchmarkSample){n1, m, 0.0, T, mdm});
+
+	// Calculate the bound state formation rate, with the bound state of the registry unless
+	// the masses differ.
+	double alpha_s = parton_alpha(GGscale);
+	double bsf_rate;
+	if (ctx->bsf_table_on)
+		bsf_rate = bound_state_rate_tabulated(ctx, x1->spin, x1->color, m, T, mdm, alpha_s);
 	else
-		*deepness = d2;
-	return;   
+	{
+		BoundStateParams bs = x1->bound_state;
+		if (bs.m != m)
+			bs = bound_state_params(ctx, x1->spin, x1->color, m, alpha_s);
+		bs.alpha_s = alpha_s;
+		bsf_rate = bound_state_rate(ctx, &bs, T, mdm);
+	}
+	// Safety check: bound state formation rate is not a number.
+	if (!isfinite(bsf_rate) || isnan(bsf_rate))
+	{
+		printf("WARNING: averaged BSF rate is not a number (%e) for %d %d -> ??? \n", bsf_rate, (int)n1, (int)n2);
+		printf("\tmass: %f, T: %f\n", m, T);
+	}
+	return bsf_rate;
 }
 
-// Integration method from micrOMEGAs.
-double simpsonArg(double (*func)(double, Parameters), Parameters pars, double a, double b, double eps)
+#endif
+
+
+/*-- Bound State Rate Table --*/
+
+double bound_state_rate_tabulated(SommerfeldContext *ctx, int spin, int color, double m, double T, double mdm, double alpha_s)
 {
-	double f[9];
-	double aEps;
-	int i, j;	
+	BsfTable *table = find_bsf_table(ctx, spin, color, alpha_s);
+	double fm = (log(m) - table->logm_min) / table->logm_step;
+	double fx = (log(m / T) - table->logx_min) / table->logx_step;
+	double fr = (log(m / mdm) - table->logr_min) / table->logr_step;
+	if (!(fm >= 0 && fm <= table->nm - 1 && fx >= 0 && fx <= table->nx - 1 && fr >= 0 && fr <= table->nr - 1))
+	{
+		BoundStateParams bs = bound_state_params(ctx, spin, color, m, alpha_s);
+		return bound_state_rate(ctx, &bs, T, mdm);
+	}
 
-	aEps=0;
-	if (a==b)
-		return 0;
-	for (i = 0; i < 9; i++)
+	// Tricubic interpolation on the four by four by four grid points around (m, x, r), where
+	// the blocks in x are calculated first if needed. On a grid point in r only its plane is used.
+	int i = (int)fm - 1, j = (int)fx - 1, k = (int)fr - 1, nplanes = 4;
+	i = i < 0 ? 0 : i > table->nm - 4 ? table->nm - 4 : i;
+	j = j < 0 ? 0 : j > table->nx - 4 ? table->nx - 4 : j;
+	k = k < 0 ? 0 : k > table->nr - 4 ? table->nr - 4 : k;
+	if (fr == floor(fr))
 	{
-		f[i] = (*func) (a + i * (b - a) / 8, pars);
-		aEps += fabs(f[i]);
+		k = (int)fr;
+		nplanes = 1;
 	}
-	if (aEps==0.)
+	bool updated = false;
+	for (int kr = k; kr < k + nplanes; kr++)
+	{
+		for (int im = i; im < i + 4; im++)
+		{
+			int row = kr * table->nm + im;
+			for (int block = j / BSF_TABLE_X_BLOCK; block <= (j + 3) / BSF_TABLE_X_BLOCK; block++)
+			{
+				if (table->filled[row * table->nblocks + block])
+					continue;
+				fill_bsf_table_block(ctx, table, row, block);
+				updated = true;
+			}
+		}
+	}
+	if (updated)
+		write_bsf_table(table);
+	double plane[4];
+	for (int kr = 0; kr < nplanes; kr++)
+	{
+		double row[4];
+		for (int im = 0; im < 4; im++)
+			row[im] = cubic_lagrange(&table->lograte[((k + kr) * table->nm + i + im) * table->nx + j], 1, fx - j);
+		plane[kr] = cubic_lagrange(row, 1, fm - i);
+	}
+	double lograte = nplanes == 1 ? plane[0] : cubic_lagrange(plane, 1, fr - k);
+	// The rate can vanish or be invalid somewhere around the point.
+	if (!isfinite(lograte))
+	{
+		BoundStateParams bs = bound_state_params(ctx, spin, color, m, alpha_s);
+		return bound_state_rate(ctx, &bs, T, mdm);
+	}
+	return exp(lograte);
+}
+
+BsfTable *find_bsf_table(SommerfeldContext *ctx, int spin, int color, double alpha_s)
+{
+	for (int i = 0; i < ctx->bsf_table_count && i < BSF_TABLE_SIZE; i++)
+	{
+		BsfTable *table = &ctx->bsf_tables[i];
+		if (table->spin == spin && table->color == color && table->alpha_s == alpha_s)
+			return table;
+	}
+
+	// Replace the oldest table if all are in use.
+	BsfTable *table = &ctx->bsf_tables[ctx->bsf_table_count % BSF_TABLE_SIZE];
+	ctx->bsf_table_count++;
+	free(table->filled);
+	free(table->lograte);
+	*table = (BsfTable){0, spin, color, alpha_s};
+	table->nm = (int)round(log10(BSF_TABLE_MMAX / BSF_TABLE_MMIN) * BSF_TABLE_M_PER_DECADE) + 1;
+	table->nx = (int)round(log10(BSF_TABLE_XMAX / BSF_TABLE_XMIN) * BSF_TABLE_X_PER_DECADE) + 1;
+	table->nr = (int)round(log10(BSF_TABLE_RMAX / BSF_TABLE_RMIN) * BSF_TABLE_R_PER_DECADE) + 1;
+	table->logm_min = log(BSF_TABLE_MMIN);
+	table->logm_step = log(10.0) / BSF_TABLE_M_PER_DECADE;
+	table->logx_min = log(BSF_TABLE_XMIN);
+	table->logx_step = log(10.0) / BSF_TABLE_X_PER_DECADE;
+	table->logr_min = log(BSF_TABLE_RMIN);
+	table->logr_step = log(10.0) / BSF_TABLE_R_PER_DECADE;
+	table->nblocks = (table->nx + BSF_TABLE_X_BLOCK - 1) / BSF_TABLE_X_BLOCK;
+	table->filled = calloc(table->nr * table->nm * table->nblocks, sizeof(char));
+	table->lograte = calloc(table->nr * table->nm * table->nx, sizeof(double));
+
+	// The hash covers the table, the alpha strong of micrOMEGAs and the alpha table.
+	uint64_t hash = 14695981039346656037ULL;
+	const AlphaTable *alpha_table = ctx->alpha_bs_table;
+	hash = hash_bytes(hash, BSF_TABLE_MAGIC, sizeof(BSF_TABLE_MAGIC));
+	hash = hash_bytes(hash, &spin, sizeof(spin));
+	hash = hash_bytes(hash, &color, sizeof(color));
+	double grid[] = {table->nm, table->nx, table->nr, table->nblocks, table->logm_min, table->logm_step, table->logx_min, table->logx_step, table->logr_min, table->logr_step};
+	hash = hash_bytes(hash, grid, sizeof(grid));
+	int quadrature[] = {ctx->gamma_diss_quadrature, ctx->sigma_bsf_quadrature};
+	hash = hash_bytes(hash, quadrature, sizeof(quadrature));
+	hash = hash_bytes(hash, &table->alpha_s, sizeof(table->alpha_s));
+	hash = hash_bytes(hash, &alpha_table->mmin, sizeof(double));
+	hash = hash_bytes(hash, &alpha_table->mstep, sizeof(double));
+	hash = hash_bytes(hash, alpha_table->values, alpha_table->nentries * alpha_table->ncolors * sizeof(double));
+	table->hash = hash;
+	if (read_bsf_table(table))
+		printf("Bound state rate table %016llx read for spin %d, color %d\n", (unsigned long long)hash, spin, color);
+	return table;
+}
+
+void fill_bsf_table_block(const SommerfeldContext *ctx, BsfTable *table, int row, int block)
+{
+	double m = exp(table->logm_min + (row % table->nm) * table->logm_step);
+	double mdm = m / exp(table->logr_min + (row / table->nm) * table->logr_step);
+	BoundStateParams bs = bound_state_params(ctx, table->spin, table->color, m, table->alpha_s);
+	for (int j = block * BSF_TABLE_X_BLOCK; j < (block + 1) * BSF_TABLE_X_BLOCK && j < table->nx; j++)
+	{
+		double T = m / exp(table->logx_min + j * table->logx_step);
+		double rate = bound_state_rate(ctx, &bs, T, mdm);
+		table->lograte[row * table->nx + j] = rate > 0 ? log(rate) : -INFINITY;
+	}
+	table->filled[row * table->nblocks + block] = 1;
+}
+
+// Adds the blocks of the file of the table which are not yet in the table, such that blocks
+// which other processes have calculated are kept.
+bool read_bsf_table(BsfTable *table)
+{
+	char name[64];
+	snprintf(name, sizeof(name), "bsf_rate_%016llx.bin", (unsigned long long)table->hash);
+	FILE *ftable = fopen(name, "rb");
+	if (ftable == NULL)
+		return false;
+	BsfTableHeader header;
+	size_t nfilled = table->nr * table->nm * table->nblocks, nvalues = table->nr * table->nm * table->nx;
+	char *filled = malloc(nfilled);
+	double *lograte = malloc(nvalues * sizeof(double));
+	bool success = filled != NULL && lograte != NULL && fread(&header, sizeof(header), 1, ftable) == 1
+		&& memcmp(header.magic, BSF_TABLE_MAGIC, sizeof(header.magic)) == 0
+		&& header.hash == table->hash && header.nm == table->nm && header.nx == table->nx && header.nr == table->nr
+		&& header.nblocks == table->nblocks
+		&& fread(filled, sizeof(char), nfilled, ftable) == nfilled
+		&& fread(lograte, sizeof(double), nvalues, ftable) == nvalues;
+	fclose(ftable);
+	if (success)
+	{
+		for (size_t i = 0; i < nfilled; i++)
+		{
+			if (table->filled[i] || !filled[i])
+				continue;
+			size_t row = i / table->nblocks, start = i % table->nblocks * BSF_TABLE_X_BLOCK;
+			size_t count = start + BSF_TABLE_X_BLOCK > (size_t)table->nx ? table->nx - start : BSF_TABLE_X_BLOCK;
+			memcpy(&table->lograte[row * table->nx + start], &lograte[row * table->nx + start], count * sizeof(double));
+			table->filled[i] = 1;
+		}
+	}
+	else
+		printf("WARNING: %s is not a valid bound state rate table\n", name);
+	free(filled);
+	free(lograte);
+	return success;
+}
+
+void write_bsf_table(BsfTable *table)
+{
+	// Merge the blocks which other processes have written since the table was read, and write
+	// to a temporary file which is renamed, such that other processes never read a partially
+	// written table. The lock file is held from the merge to the rename, such that processes
+	// which write at the same time do not drop the blocks of each other.
+	char name[64], temp_name[80], lock_name[80];
+	snprintf(name, sizeof(name), "bsf_rate_%016llx.bin", (unsigned long long)table->hash);
+	snprintf(temp_name, sizeof(temp_name), "%s.%d", name, (int)getpid());
+	snprintf(lock_name, sizeof(lock_name), "%s.lock", name);
+	int lock = open(lock_name, O_RDWR | O_CREAT, 0644);
+	if (lock < 0 || flock(lock, LOCK_EX) != 0)
+	{
+		printf("WARNING: can not lock the bound state rate table %s\n", name);
+		if (lock >= 0)
+			close(lock);
+		return;
+	}
+	read_bsf_table(table);
+	FILE *ftable = fopen(temp_name, "wb");
+	bool success = ftable != NULL;
+	if (success)
+	{
+		BsfTableHeader header = {BSF_TABLE_MAGIC, table->hash, table->nm, table->nx, table->nr, table->nblocks};
+		size_t nfilled = table->nr * table->nm * table->nblocks, nvalues = table->nr * table->nm * table->nx;
+		success = fwrite(&header, sizeof(header), 1, ftable) == 1 && fwrite(table->filled, sizeof(char), nfilled, ftable) == nfilled
+			&& fwrite(table->lograte, sizeof(double), nvalues, ftable) == nvalues;
+		success = fclose(ftable) == 0 && success;
+	}
+	if (!success || rename(temp_name, name) != 0)
+	{
+		printf("WARNING: can not write the bound state rate table %s\n", name);
+		remove(temp_name);
+	}
+	flock(lock, LOCK_UN);
+	close(lock);
+}
+
+// FNV-1a hash of a block of memory.
+uint64_t hash_bytes(uint64_t hash, const void *data, size_t size)
+{
+	const unsigned char *bytes = data;
+	for (size_t i = 0; i < size; i++)
+	{
+		hash ^= bytes[i];
+		hash *= 1099511628211ULL;
+	}
+	return hash;
+}
+
+
+/*-- Bound State Formation --*/
+
+// Helper function to compute an exponential without underflowing.
+double exp_cut(double x)
+{
+	if (x < -50)
 		return 0;
-	eps = eps / 2;
-	aEps = eps * aEps * fabs(b - a) / 9;
+	return exp(x);
+}
 
-	for (j = 0; ; j++)
+bool read_table_alpha(void)
+{
+	// Convert the text table if the binary table is older than the text or not valid.
+	struct stat text_stat, binary_stat;
+	bool has_text = stat(ALPHA_TABLE_TEXT, &text_stat) == 0;
+	bool has_binary = stat(ALPHA_TABLE_BINARY, &binary_stat) == 0;
+	size_t size;
+	const AlphaTableHeader *header = NULL;
+	if (has_binary && (!has_text || binary_stat.st_mtime >= text_stat.st_mtime))
+		header = map_table_alpha(ALPHA_TABLE_BINARY, &size);
+#ifndef SOMMERFELD_LIBRARY
+	// The library does not write files into the working directory of the program which uses
+	// it, it only maps a binary table which exists.
+	if (header == NULL && has_text)
 	{
-		double ans=0.0, aAns=0.0; 
-		int deepness = 1;
-		r_simpson(func, pars, f, a, b, eps, &aEps, &ans, &aAns, &deepness);
-		if (5 * aAns * eps > aEps || j >= 2 )
-			return ans;
-		if (!isfinite(aAns))
-			return aAns;
-		for (i = 0; i < 9; i++)
-			f[i]=(*func)(a + i * (b - a) / 8, pars);
-		aEps = aAns * eps;
+		if (convert_table_alpha(ALPHA_TABLE_TEXT, ALPHA_TABLE_BINARY))
+			header = map_table_alpha(ALPHA_TABLE_BINARY, &size);
+		else
+			printf("WARNING: can not write %s, the text table is used\n", ALPHA_TABLE_BINARY);
+	}
+#endif
+
+	// The mapping is kept until the program exits.
+	if (header != NULL)
+	{
+		alpha_bs_table = (AlphaTable){(const double *)(header + 1), header->nentries, header->ncolors, header->mmin, header->mstep};
+		return true;
+	}
+
+	// Without a valid binary table the text table is read into memory.
+	AlphaTableHeader text_header;
+	const double *values = parse_table_alpha(ALPHA_TABLE_TEXT, &text_header);
+	if (values == NULL)
+	{
+		printf("Can not read the alpha table for bound states from %s\n", ALPHA_TABLE_TEXT);
+		return false;
+	}
+	alpha_bs_table = (AlphaTable){values, text_header.nentries, text_header.ncolors, text_header.mmin, text_header.mstep};
+	return true;
+}
+
+const AlphaTableHeader *map_table_alpha(const char *binary_name, size_t *size)
+{
+	int fd = open(binary_name, O_RDONLY);
+	if (fd < 0)
+		return NULL;
+	struct stat binary_stat;
+	if (fstat(fd, &binary_stat) != 0 || binary_stat.st_size < (off_t)sizeof(AlphaTableHeader))
+	{
+		close(fd);
+		return NULL;
+	}
+	*size = binary_stat.st_size;
+	void *data = mmap(NULL, *size, PROT_READ, MAP_SHARED, fd, 0);
+	close(fd);
+	if (data == MAP_FAILED)
+		return NULL;
+
+	// Check that the file is complete and was written by this version.
+	const AlphaTableHeader *header = data;
+	if (memcmp(header->magic, ALPHA_TABLE_MAGIC, sizeof(header->magic)) != 0 || header->version != ALPHA_TABLE_VERSION
+		|| header->ncolors != ALPHA_TABLE_COLORS || header->nentries < 2
+		|| *size != sizeof(AlphaTableHeader) + header->nentries * header->ncolors * sizeof(double))
+	{
+		printf("WARNING: %s is not a valid alpha table\n", binary_name);
+		munmap(data, *size);
+		return NULL;
+	}
+	return header;
+}
+
+bool convert_table_alpha(const char *text_name, const char *binary_name)
+{
+	AlphaTableHeader header;
+	double *values = parse_table_alpha(text_name, &header);
+	if (values == NULL)
+		return false;
+
+	// Write to a temporary file which is renamed, such that other processes never map a
+	// partially written table.
+	char temp_name[256];
+	snprintf(temp_name, sizeof(temp_name), "%s.%d", binary_name, (int)getpid());
+	FILE *fbinary = fopen(temp_name, "wb");
+	bool success = fbinary != NULL;
+	if (success)
+	{
+		size_t nvalues = header.nentries * header.ncolors;
+		success = fwrite(&header, sizeof(header), 1, fbinary) == 1 && fwrite(values, sizeof(double), nvalues, fbinary) == nvalues;
+		success = fclose(fbinary) == 0 && success;
+		success = success && rename(temp_name, binary_name) == 0;
+		if (!success)
+			remove(temp_name);
+	}
+	free(values);
+	if (success)
+		printf("Converted %s to %s\n", text_name, binary_name);
+	return success;
+}
+
+// Reads the text table and returns the values of all rows, the masses must be equally spaced.
+double *parse_table_alpha(const char *text_name, AlphaTableHeader *header)
+{
+	FILE *falpha = fopen(text_name, "r");
+	if (falpha == NULL)
+	{
+		printf("WARNING: can not open %s: %s\n", text_name, strerror(errno));
+		return NULL;
+	}
+	memset(header, 0, sizeof(*header));
+	memcpy(header->magic, ALPHA_TABLE_MAGIC, sizeof(header->magic));
+	header->version = ALPHA_TABLE_VERSION;
+	header->ncolors = ALPHA_TABLE_COLORS;
+
+	int capacity = 2048;
+	double *values = malloc(capacity * ALPHA_TABLE_COLORS * sizeof(double));
+	double m, alpha3, alpha6, alpha8;
+	while (fscanf(falpha, "%lf %lf %lf %lf", &m, &alpha3, &alpha6, &alpha8) == 4)
+	{
+		int n = header->nentries;
+		if (n == 0)
+			header->mmin = m;
+		else if (n == 1)
+			header->mstep = m - header->mmin;
+		if (n > 0 && (header->mstep <= 0 || fabs(m - (header->mmin + n * header->mstep)) > 1e-6 * header->mstep))
+		{
+			printf("WARNING: masses in %s are not equally spaced at %f\n", text_name, m);
+			free(values);
+			fclose(falpha);
+			return NULL;
+		}
+		if (n == capacity)
+		{
+			capacity *= 2;
+			values = realloc(values, capacity * ALPHA_TABLE_COLORS * sizeof(double));
+		}
+		values[n * ALPHA_TABLE_COLORS] = alpha3;
+		values[n * ALPHA_TABLE_COLORS + 1] = alpha6;
+		values[n * ALPHA_TABLE_COLORS + 2] = alpha8;
+		header->nentries++;
 	}
+	fclose(falpha);
+	if (header->nentries < 2)
+	{
+		free(values);
+		return NULL;
+	}
+	return values;
 }
 
-double zeta(int color, double m)
+// Alpha strong for the bound state formation is determined from a recursive formula in Mathermatica and is read in from a table.
+double alphaS_bs(int color, double m, const AlphaTable *table)
 {
-	double alphaS_boundstate = alphaS_bs(color, m, alpha_table);
+	static const int colors[] = ALPHA_TABLE_COLOR_LIST;
+	int color_index = -1;
+	for (int c = 0; c < table->ncolors; c++)
+		if (colors[c] == color)
+			color_index = c;
+	if (color_index < 0)
+	{
+		printf("WARNING: alphaS_bs called with color: %d.\n", color);
+		return NAN;
+	}
+
+	// Above the table alpha strong is calculated, below it the first entry is used.
+	double x = (m - table->mmin) / table->mstep;
+	int64_t n = table->nentries;
+	if (x > n - 1)
+		return alphaS_bs_tail(color, m) * table->values[(n - 1) * table->ncolors + color_index] / alphaS_bs_tail(color, table->mmin + (n - 1) * table->mstep);
+	if (!(x > 0))
+		return table->values[color_index];
+
+	// Cubic Lagrange interpolation on the four entries around m, shifted inside the table.
+	int64_t i = (int64_t)x - 1;
+	if (i < 0)
+		i = 0;
+	if (i > n - 4)
+		i = n - 4;
+	return cubic_lagrange(&table->values[i * table->ncolors + color_index], table->ncolors, x - i);
+}
+
+// Cubic Lagrange polynomial through y[0], y[stride], y[2 * stride] and y[3 * stride] at t.
+double cubic_lagrange(const double *y, long stride, double t)
+{
+	return -y[0] * (t - 1) * (t - 2) * (t - 3) / 6 + y[stride] * t * (t - 2) * (t - 3) / 2 - y[2 * stride] * t * (t - 1) * (t - 3) / 2 + y[3 * stride] * t * (t - 1) * (t - 2) / 6;
+}
+
+// The table contains casimir2 * alpha_strong at the momentum of the bound state, which is
+// half of the mass times this value. It is the fixed point of the iteration below.
+double alphaS_bs_tail(int color, double m)
+{
+	double c2 = casimir2(color);
+	double alpha = alpha_strong(m);
+	for (int i = 0; i < ALPHA_TAIL_MAX_ITERATIONS; i++)
+	{
+		double next = alpha_strong(c2 * alpha * m / 2.0);
+		if (fabs(next - alpha) <= ALPHA_TAIL_EPS * next)
+			return c2 * next;
+		alpha = next;
+	}
+	printf("WARNING: alphaS_bs did not converge for color %d and mass %f\n", color, m);
+	return c2 * alpha;
+}
+
+BoundStateParams bound_state_params(const SommerfeldContext *ctx, int spin, int color, double m, double alpha_s)
+{
+	BoundStateParams bs = {spin, color, m, casimir2(color)};
+	double alphaS_boundstate = alphaS_bs(color, m, ctx->alpha_bs_table);
+	bs.zeta = bs.casimir * alphaS_boundstate;
+	bs.zetap = (bs.casimir - 1.5) * alphaS_boundstate;
+	bs.kappa = bs.zeta / fabs(bs.zetap);
+	bs.energy = pow(bs.zeta, 2.0) * m / 4.0;
+	bs.bohr_radius = 2.0 / (bs.zeta * m);
+	bs.alpha_s = alpha_s;
+	return bs;
+}
+
+double zeta(int color, double m, const AlphaTable *table)
+{
+	double alphaS_boundstate = alphaS_bs(color, m, table);
 	return casimir2(color) * alphaS_boundstate;
 }
 
-double zetap(int color, double m)
+double zetap(int color, double m, const AlphaTable *table)
 {
-	double alphaS_boundstate = alphaS_bs(color, m, alpha_table);
+	double alphaS_boundstate = alphaS_bs(color, m, table);
 	return (casimir2(color) - 1.5) * alphaS_boundstate;
 }
 
-double kappa(int color, double m)
+double kappa(int color, double m, const AlphaTable *table)
 {
-	return zeta(color, m) / fabs(zetap(color, m));
+	return zeta(color, m, table) / fabs(zetap(color, m, table));
 }
 
-double BE(int color, double m)
+double BE(int color, double m, const AlphaTable *table)
 {
-	double z = zeta(color, m);
+	double z = zeta(color, m, table);
 	return pow(z, 2.0) * m / 4.0;
 }
 
-double nu(int color, double m, double z, double u)
+double nu(double kappa, double z, double u)
 {
-	return 1.0 / kappa(color, m) * sqrt(z / u);
+	return 1.0 / kappa * sqrt(z / u);
 }
 
-double bohr_radius(int color, double m)
+double bohr_radius(int color, double m, const AlphaTable *table)
 {
-	return 2.0 / (zeta(color, m) * m);
+	return 2.0 / (zeta(color, m, table) * m);
 }
 
 int g_freedom(int spin, int color)
@@ -746,24 +2842,24 @@ double fMB(double m, double T, double vrel)
 	return pow(m / (4 * M_PI * T), 1.5) * 4 * M_PI * pow(vrel, 2.0) * exp_cut(-m * pow(vrel, 2.0) / (4.0 * T));
 }
 
-double sigmaDiss(int spin, int color, double m, double T, double u)
+double sigmaDiss(const BoundStateParams *bs, double T, double u)
 {
-	double alphaS = parton_alpha(GGscale);
-	double zetp = zetap(color, m);
-	double k = kappa(color, m);
-	double E = BE(color, m);
-	double a = bohr_radius(color, m); 
+	double alphaS = bs->alpha_s;
+	double zetp = bs->zetap;
+	double k = bs->kappa;
+	double E = bs->energy;
+	double a = bs->bohr_radius; 
 	double z = E / T;
 	double omega = E * (1 + u / z);
 	// Compute prefactor with gluon averaging and color.
-	int symmetry_factor = (spin - 1) % 2 == 0 ? 2: 1;
-	double prefact = 1.0 / 8 * casimir2(color) * symmetry_factor;
+	int symmetry_factor = (bs->spin - 1) % 2 == 0 ? 2: 1;
+	double prefact = 1.0 / 8 * bs->casimir * symmetry_factor;
 	// Compute common factor (for attractive and repulsive potentials).
 	double coeff = pow(2, 9) * pow(M_PI, 2.0) / 3.0 * alphaS * pow(a, 2.0) * pow(E / omega, 4.0);
 	double coeff2 = 1.0;
 	if (u > 1e-6)
 	{
-		double v = nu(color, m, z, u);
+		double v = nu(k, z, u);
 		coeff *= (1 + pow(v, 2))/(1 + pow(k * v, 2));
 		coeff /= k * (1 - exp_cut(-2 * M_PI * v));
 		// Compute factor that depends on whether the potential is attractive or repulsive.
@@ -783,11 +2879,42 @@ double sigmaDiss(int spin, int color, double m, double T, double u)
 	return prefact * coeff * coeff2;
 }
 
+// Batch version of sigmaDiss for an array of u, the branches on u are replaced by selects such
+// that the compiler can vectorize the loop.
+BATCH_TARGETS void sigmaDiss_batch(const BoundStateParams *bs, double T, const double *u_list, double *out, int n)
+{
+	double alphaS = bs->alpha_s;
+	double k = bs->kappa;
+	double E = bs->energy;
+	double a = bs->bohr_radius;
+	double z = E / T;
+	int symmetry_factor = (bs->spin - 1) % 2 == 0 ? 2: 1;
+	double prefact = 1.0 / 8 * bs->casimir * symmetry_factor;
+	double common = prefact * pow(2, 9) * pow(M_PI, 2.0) / 3.0 * alphaS * pow(a, 2.0);
+	// The exponent of coeff2 for attractive and repulsive potentials, and its limit in 0.
+	bool attractive = bs->zetap > 0;
+	double atan_factor = attractive ? -4.0 : 4.0;
+	double linear_factor = attractive ? 0.0 : -2.0 * M_PI;
+	double coeff2_zero = attractive ? exp_cut(-4.0 / k) / pow(k, 3.0) : 0.0;
+	for (int i = 0; i < n; i++)
+	{
+		double u = u_list[i];
+		bool small = u <= 1e-6;
+		double ratio = 1.0 / (1.0 + u / z);
+		double v = sqrt_simd(z / (small ? 1.0 : u)) / k;
+		double kv = k * v;
+		double coeff = (1 + v * v) / (1 + kv * kv) / (k * (1 - exp_cut_simd(-2 * M_PI * v)));
+		double coeff2 = exp_cut_simd(atan_factor * v * atan_simd(1.0 / kv) + linear_factor * v);
+		out[i] = common * ratio * ratio * ratio * ratio * (small ? coeff2_zero : coeff * coeff2);
+	}
+}
+
 double sigmaStimulatedBSF(double u, Parameters pars)
 {
-	double E = BE(pars.color, pars.m);
+	const BoundStateParams *bs = pars.bound_state;
+	double E = bs->energy;
 	double z = E / pars.T;
-	double vrel = zeta(pars.color, pars.m) * sqrt(u / z);
+	double vrel = bs->zeta * sqrt(u / z);
 	double omega = E + 0.25 * pars.m * pow(vrel, 2.0);
 	int gg = 16;
 	int gX = g_freedom(pars.spin, pars.color);
@@ -795,14 +2922,36 @@ double sigmaStimulatedBSF(double u, Parameters pars)
 	int symmetry_factor = (pars.spin - 1) % 2 == 0 ? 2 : 1;
 	double stimulated_emission = 1 + 1/(exp(omega/pars.T) - 1);
 	double prefact = gg * pow(omega, 2.0) / (pow(gX, 2.0) * pow(spinfact, 2.0) * pow(0.5 * pars.m * vrel, 2.0));
-	return prefact * sigmaDiss(pars.spin, pars.color, pars.m, pars.T, u) * symmetry_factor * stimulated_emission;
+	return prefact * sigmaDiss(bs, pars.T, u) * symmetry_factor * stimulated_emission;
+}
+
+BATCH_TARGETS void sigmaStimulatedBSF_batch(const double *u, double *out, int n, const Parameters *pars)
+{
+	const BoundStateParams *bs = pars->bound_state;
+	double E = bs->energy;
+	double z = E / pars->T;
+	int gg = 16;
+	int gX = g_freedom(pars->spin, pars->color);
+	int spinfact = (pars->spin - 1) / 2 + 1;
+	int symmetry_factor = (pars->spin - 1) % 2 == 0 ? 2 : 1;
+	double prefact = gg * symmetry_factor / (pow(gX, 2.0) * pow(spinfact, 2.0) * pow(0.5 * pars->m, 2.0));
+	sigmaDiss_batch(bs, pars->T, u, out, n);
+	for (int i = 0; i < n; i++)
+	{
+		double vrel2 = bs->zeta * bs->zeta * u[i] / z;
+		double omega = E + 0.25 * pars->m * vrel2;
+		double stimulated_emission = 1 + 1 / (exp_simd(omega / pars->T) - 1);
+		out[i] *= prefact * omega * omega / vrel2 * stimulated_emission;
+	}
 }
 
-double GammaBS(int spin, int color, double m, int spin_eta)
+double GammaBS(const BoundStateParams *bs, int spin_eta)
 {
+	int spin = bs->spin;
+	int color = bs->color;
 	int spin_fact = (spin - 1) / 2 + 1;
-	double alphaS = parton_alpha(GGscale);
-	double zet = zeta(color, m);
+	double alphaS = bs->alpha_s;
+	double zet = bs->zeta;
 	double col_factor = 0.0;
 	if (color == 3) col_factor = 1.0 / 6;
 	if (color == 6) col_factor = 25.0 / 12;
@@ -816,62 +2965,844 @@ double GammaBS(int spin, int color, double m, int spin_eta)
 		if (spin == 5 || spin == 6)
 			spin_eta_factor = 16.0 / 3.0;
 	}
-	return col_factor * spin_fact * symmetry_factor * spin_eta_factor * m * pow(alphaS, 2.0) * pow(zet, 3.0);
+	return col_factor * spin_fact * symmetry_factor * spin_eta_factor * bs->m * pow(alphaS, 2.0) * pow(zet, 3.0);
 }
 
-double GammaDissIntegrand(double u, Parameters pars)
+BATCH_TARGETS void GammaDissIntegrand_batch(const double *u, double *out, int n, const Parameters *pars)
 {
-	double E = BE(pars.color, pars.m);
+	double E = pars->bound_state->energy;
 	int gg = 16;
 	double prefact = gg * 4 * M_PI / pow(2 * M_PI, 3);
-	double z = E / pars.T;
-	double distr = pow(E, 3) * pow(1 + u / z, 2) / (z * (exp(z + u) - 1));
-	double integrand = prefact * distr * sigmaDiss(pars.spin, pars.color, pars.m, pars.T, u);
-	return integrand;
+	double z = E / pars->T;
+	sigmaDiss_batch(pars->bound_state, pars->T, u, out, n);
+	for (int i = 0; i < n; i++)
+	{
+		double w = 1 + u[i] / z;
+		double distr = E * E * E * w * w / (z * (exp_simd(z + u[i]) - 1));
+		out[i] *= prefact * distr;
+	}
 }
 
-double GammaDiss(int spin, int color, double m, double T)
+double GammaDiss(const SommerfeldContext *ctx, const BoundStateParams *bs, double T)
 {
-	double E = BE(color, m);
+	double E = bs->energy;
 	double z = E / T;
-	double zet = zeta(color, m);
+	double zet = bs->zeta;
 	double upper_u = z / 4.0 / pow(zet, 2.0);
-	Parameters pars = {spin, color, m, T};
-	double gamma = simpsonArg(GammaDissIntegrand, pars, 0, upper_u, 1e-6);
+	Parameters pars = {bs->spin, bs->color, bs->m, T, bs};
+	QuadratureDiagnostics diag;
+	double gamma = integrate(ctx->gamma_diss_quadrature, GammaDissIntegrand_batch, &pars, 0, upper_u, QUADRATURE_EPS, &diag);
+	check_quadrature("GammaDiss", &pars, &diag);
 	return gamma;
 }
 
-double sigmaBSFaveraged(int spin, int color, double m, double T)
+double sigmaBSFaveraged(const SommerfeldContext *ctx, const BoundStateParams *bs, double T, double mdm)
 {
-	double E = BE(color, m);
-	double z = E / T;
-	double zet = zeta(color, m);
-	Parameters pars = {spin, color, m, T};
-	double sigma = simpsonArg(s_integrand_BSF, pars, 0, 1, 1e-6);
+	Parameters pars = {bs->spin, bs->color, bs->m, T, bs, mdm};
+	QuadratureDiagnostics diag;
+	double sigma = integrate(ctx->sigma_bsf_quadrature, s_integrand_BSF_batch, &pars, 0, 1, QUADRATURE_EPS, &diag);
+	check_quadrature("sigmaBSFaveraged", &pars, &diag);
 	return sigma;
 }
 
-double GammaBSaveraged(int spin, int color, double m, int spin_eta, double T)
+double GammaBSaveraged(const BoundStateParams *bs, int spin_eta, double T)
 {
-	double E = BE(color, m);
-	double mBS = 2 * m - E;
+	double E = bs->energy;
+	double mBS = 2 * bs->m - E;
 	double ratio = bessK1(mBS / T) / bessK2(mBS / T);
 	if (isnan(ratio))
 		ratio = 1;
-	return GammaBS(spin, color, m, spin_eta) * ratio;
+	return GammaBS(bs, spin_eta) * ratio;
+}
+
+double bound_state_rate(const SommerfeldContext *ctx, const BoundStateParams *bs, double T, double mdm)
+{
+	BoundStateRates rates = bound_state_rates(ctx, bs, T, mdm);
+	return combine_bound_state_rates(bs, &rates);
 }
 
-double bound_state_rate(int spin, int color, double m, double T)
+// Evaluates each of the integrals once, they are shared by the spin-0 and spin-2 bound states.
+BoundStateRates bound_state_rates(const SommerfeldContext *ctx, const BoundStateParams *bs, double T, double mdm)
+{
+	BoundStateRates rates = {T, mdm};
+	rates.sigma_bsf = sigmaBSFaveraged(ctx, bs, T, mdm);
+	rates.gamma_diss = GammaDiss(ctx, bs, T);
+	rates.gamma_bs[0] = GammaBSaveraged(bs, 0, T);
+	if (bs->spin == 5 || bs->spin == 6)
+		rates.gamma_bs[1] = GammaBSaveraged(bs, 2, T);
+	return rates;
+}
+
+double combine_bound_state_rates(const BoundStateParams *bs, const BoundStateRates *rates)
 {
 	// This code includes the rate for the formation of spin-2 bound states for vectors.
-	double gamma_bs_spin0 = GammaBSaveraged(spin, color, m, 0, T);
-	double bound_state_rate_spin0 = sigmaBSFaveraged(spin, color, m, T) * gamma_bs_spin0 / (gamma_bs_spin0 + GammaDiss(spin, color, m, T));
+	double bound_state_rate_spin0 = rates->sigma_bsf * rates->gamma_bs[0] / (rates->gamma_bs[0] + rates->gamma_diss);
 	double bound_state_rate_spin2 = 0.0;
-	if (spin == 5 || spin == 6)
+	if (bs->spin == 5 || bs->spin == 6)
+		bound_state_rate_spin2 = 25 * rates->sigma_bsf * rates->gamma_bs[1] / (rates->gamma_bs[1] + rates->gamma_diss);
+	return bound_state_rate_spin0 + bound_state_rate_spin2;
+}
+
+
+/*-- Quadrature --*/
+
+// Selects the quadrature rules for GammaDiss and sigmaBSFaveraged by name.
+bool parse_quadrature(SommerfeldContext *ctx, const char *name)
+{
+	for (int i = 0; i < NR_QUADRATURE_RULES; i++)
 	{
-		double gamma_bs_spin2 = GammaBSaveraged(spin, color, m, 2, T);
-		bound_state_rate_spin2 = 25 * sigmaBSFaveraged(spin, color, m, T) * gamma_bs_spin2 / (gamma_bs_spin2 + GammaDiss(spin, color, m, T));
+		if (strcmp(name, quadrature_names[i]) != 0)
+			continue;
+		ctx->gamma_diss_quadrature = (QuadratureRule)i;
+		// The integral of sigmaBSFaveraged is over a finite interval and does not decay.
+		ctx->sigma_bsf_quadrature = i == QUADRATURE_GAUSS_LAGUERRE ? QUADRATURE_TANH_SINH : (QuadratureRule)i;
+		return true;
 	}
-	return bound_state_rate_spin0 + bound_state_rate_spin2;
+	return false;
+}
+
+double integrate(QuadratureRule rule, Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag)
+{
+	*diag = (QuadratureDiagnostics){0};
+	switch (rule)
+	{
+	case QUADRATURE_GAUSS_LAGUERRE:
+		return gauss_laguerre(func, pars, a, b, eps, diag);
+	case QUADRATURE_TANH_SINH:
+		return tanh_sinh(func, pars, a, b, eps, diag);
+	default:
+		return simpsonArg(func, pars, a, b, eps, diag);
+	}
+}
+
+void check_quadrature(const char *name, const Parameters *pars, const QuadratureDiagnostics *diag)
+{
+	if (diag->exhausted)
+		printf("WARNING: %s stopped after %ld evaluations for spin %d, color %d, m = %g and T = %g with error %.1e\n", name, diag->evaluations, pars->spin, pars->color, pars->m, pars->T, diag->error);
+}
+
+// Integration method from micrOMEGAs, the recursion is replaced by a stack of the right halves
+// which remain to be integrated. An interval is not divided further if the evaluations for it
+// and for the intervals on the stack would exceed the budget.
+static void r_simpson(Integrand func, const Parameters *pars, double *f, double a, double b, double eps, double *aEps, double *ans, double *aAns, QuadratureDiagnostics *diag)
+{
+	SimpsonInterval stack[SIMPSON_MAX_DEPTH];
+	int nstack = 0;
+	int depth = 1;
+	int i;
+	double s1, s2, s3, e_err;
+	double u[4], fu[4];
+
+	while (true)
+	{
+		s1 = (f[0] + 4 * f[4] + f[8])/6;
+		s2 = (f[0] + 4 * f[2] + 2 * f[4] + 4 * f[6] + f[8]) / 12;
+		s3 = (f[0] + 4 * f[1] + 2 * f[2] + 4 * f[3] + 2 * f[4] + 4 * f[5] + 2 * f[6] + 4 * f[7] + f[8]) / 24;
+
+		if (!isfinite(s3))
+		{
+			*ans = s3;
+			*aAns = s3;
+			return;
+		}
+
+		e_err = eps * fabs(s3);
+		i = 0;
+		if ((fabs(s3 - s2) < e_err && fabs(s3 - s1) < 16 * e_err))
+			i = 1;
+		else if (fabs(s3 - s2) * (b - a) < 0.1 * (*aEps) && fabs(s3 - s1) * (b - a) < 1.6 * (*aEps))
+		{
+			i = 1;
+			*aEps -= fabs((s3 - s2) * (b - a));
+		}
+
+		bool budget = diag->evaluations + 4 * nstack + 8 > QUADRATURE_MAX_EVALUATIONS;
+		if (i || depth > SIMPSON_MAX_DEPTH || budget)
+		{
+			*ans += s3 * (b - a);
+			*aAns += (fabs(f[0]) + 4 * fabs(f[2]) + 2 * fabs(f[4]) + 4 * fabs(f[6]) + fabs(f[8])) * fabs(b - a) / 12;
+			diag->error += fabs((s3 - s2) * (b - a));
+			diag->exhausted |= !i && budget;
+			if (depth > diag->depth)
+				diag->depth = depth;
+			if (nstack == 0)
+				return;
+
+			// Continue with the right half of the last divided interval.
+			SimpsonInterval *next = &stack[--nstack];
+			for (i = 0; i < 5; i++)
+				f[2 * i] = next->f[i];
+			for (i = 0; i < 4; i++)
+				u[i] = (next->a + next->b) / 2 + (2 * i + 1) * (next->b - next->a) / 16;
+			(*func)(u, fu, 4, pars);
+			for (i = 0; i < 4; i++)
+				f[2 * i + 1] = fu[i];
+			diag->evaluations += 4;
+			a = (next->a + next->b) / 2;
+			b = next->b;
+			depth = next->depth;
+			continue;
+		}
+
+		// Divide the interval, the right half is stored and the left half is integrated first.
+		SimpsonInterval *right = &stack[nstack++];
+		*right = (SimpsonInterval){a, b, {f[4], f[5], f[6], f[7], f[8]}, depth + 1};
+		for (i = 8; i > 0; i -= 2)
+			f[i] = f[i / 2];
+		for (i = 0; i < 4; i++)
+			u[i] = a + (2 * i + 1) * (b - a) / 16;
+		(*func)(u, fu, 4, pars);
+		for (i = 0; i < 4; i++)
+			f[2 * i + 1] = fu[i];
+		diag->evaluations += 4;
+		b = (a + b) / 2;
+		depth++;
+	}
+}
+
+// Integration method from micrOMEGAs.
+double simpsonArg(Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag)
+{
+	double f[9], u[9];
+	double aEps;
+	int i, j;
+
+	aEps=0;
+	if (a==b)
+		return 0;
+	for (i = 0; i < 9; i++)
+		u[i] = a + i * (b - a) / 8;
+	(*func)(u, f, 9, pars);
+	for (i = 0; i < 9; i++)
+		aEps += fabs(f[i]);
+	diag->evaluations += 9;
+	if (aEps==0.)
+		return 0;
+	eps = eps / 2;
+	aEps = eps * aEps * fabs(b - a) / 9;
+
+	for (j = 0; ; j++)
+	{
+		double ans=0.0, aAns=0.0;
+		diag->error = 0;
+		r_simpson(func, pars, f, a, b, eps, &aEps, &ans, &aAns, diag);
+		if (5 * aAns * eps > aEps || j >= 2 || diag->exhausted)
+			return ans;
+		if (!isfinite(aAns))
+			return aAns;
+		if (diag->evaluations + 9 > QUADRATURE_MAX_EVALUATIONS)
+		{
+			diag->exhausted = true;
+			return ans;
+		}
+		(*func)(u, f, 9, pars);
+		diag->evaluations += 9;
+		aEps = aAns * eps;
+	}
+}
+
+// Sum of the Gauss-Laguerre rule with the given nodes from a, for the nodes below b.
+static double gauss_laguerre_sum(Integrand func, const Parameters *pars, double a, double b, const double *nodes, const double *weights, int order, QuadratureDiagnostics *diag)
+{
+	double u[GAUSS_LAGUERRE_ORDER], f[GAUSS_LAGUERRE_ORDER];
+	int n = 0;
+	while (n < order && nodes[n] < b - a)
+	{
+		u[n] = a + nodes[n];
+		n++;
+	}
+	(*func)(u, f, n, pars);
+	diag->evaluations += n;
+	double sum = 0;
+	for (int i = 0; i < n; i++)
+		sum += weights[i] * f[i];
+	return sum;
+}
+
+// Integrates a function which decays as exp(-(u - a)) from a to b, the integrand is taken to be
+// zero beyond b which is exact up to about exp(-(b - a)). For shorter intervals the tanh-sinh
+// rule is used instead. The difference to the rule of half the order is the estimate of the
+// error, which is too large for integrands that are not smooth enough, e.g. near thresholds.
+double gauss_laguerre(Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag)
+{
+	if (b - a < -log(eps))
+		return tanh_sinh(func, pars, a, b, eps, diag);
+	double sum = gauss_laguerre_sum(func, pars, a, b, gauss_laguerre_nodes, gauss_laguerre_weights, GAUSS_LAGUERRE_ORDER, diag);
+	double half_sum = gauss_laguerre_sum(func, pars, a, b, gauss_laguerre_half_nodes, gauss_laguerre_half_weights, GAUSS_LAGUERRE_ORDER / 2, diag);
+	diag->error = fabs(sum - half_sum);
+	diag->exhausted = diag->error > eps * fabs(sum);
+	return sum;
+}
+
+// The nodes are the roots of the Laguerre polynomial of order n, found by Newton's method from
+// the asymptotic estimates of Numerical Recipes, and the weights are multiplied by exp(node).
+static void build_laguerre_rule(int n, double *nodes, double *weights)
+{
+	double z = 0;
+	for (int i = 0; i < n; i++)
+	{
+		if (i == 0)
+			z = 3.0 / (1.0 + 2.4 * n);
+		else if (i == 1)
+			z += 15.0 / (1.0 + 2.5 * n);
+		else
+			z += (1.0 + 2.55 * (i - 1)) / (1.9 * (i - 1)) * (z - nodes[i - 2]);
+		double p1 = 1, p2 = 0, derivative = 1;
+		for (int iter = 0; iter < 100; iter++)
+		{
+			// Evaluate L_n(z) and L_{n-1}(z) with the recurrence relation.
+			p1 = 1;
+			p2 = 0;
+			for (int j = 1; j <= n; j++)
+			{
+				double p3 = p2;
+				p2 = p1;
+				p1 = ((2 * j - 1 - z) * p2 - (j - 1) * p3) / j;
+			}
+			derivative = n * (p1 - p2) / z;
+			double previous = z;
+			z = previous - p1 / derivative;
+			if (fabs(z - previous) <= 1e-14 * z)
+				break;
+		}
+		nodes[i] = z;
+		weights[i] = -exp(z) / (derivative * n * p2);
+	}
+}
+
+void build_gauss_laguerre(void)
+{
+	build_laguerre_rule(GAUSS_LAGUERRE_ORDER, gauss_laguerre_nodes, gauss_laguerre_weights);
+	build_laguerre_rule(GAUSS_LAGUERRE_ORDER / 2, gauss_laguerre_half_nodes, gauss_laguerre_half_weights);
+}
+
+// Integrates from a to b with the substitution u = c + d * tanh(pi / 2 * sinh(t)), the trapezoidal
+// sum in t converges double exponentially even with integrable singularities at the endpoints.
+// The distance of the nodes to the endpoints is calculated directly to keep its precision. The
+// error roughly squares with each halving of the step, so the integral is converged to eps once
+// two levels agree to sqrt(eps). The nodes of a level are evaluated in panels of pairs of nodes.
+double tanh_sinh(Integrand func, const Parameters *pars, double a, double b, double eps, QuadratureDiagnostics *diag)
+{
+	double c = (a + b) / 2, d = (b - a) / 2;
+	if (d == 0)
+		return 0;
+	double h = 1.0;
+	double u[QUADRATURE_BATCH_SIZE], f[QUADRATURE_BATCH_SIZE], weight[QUADRATURE_BATCH_SIZE / 2];
+	(*func)(&c, f, 1, pars);
+	double sum = M_PI / 2 * f[0];
+	diag->evaluations++;
+	double integral = 0;
+	for (int level = 0; level <= TANH_SINH_MAX_LEVEL; level++)
+	{
+		// The first level has all nodes, later levels add the ones between them.
+		int step = level == 0 ? 1 : 2;
+		int nodes = (int)(TANH_SINH_TMAX / h);
+		if (diag->evaluations + 2 * (nodes + step - 1) / step > QUADRATURE_MAX_EVALUATIONS)
+			break;
+		for (int k = 1; k <= nodes; )
+		{
+			int npairs = 0;
+			for (; k <= nodes && npairs < QUADRATURE_BATCH_SIZE / 2; k += step, npairs++)
+			{
+				double s = M_PI / 2 * sinh(k * h);
+				double ch = cosh(s);
+				double distance = d * exp(-s) / ch;
+				weight[npairs] = M_PI / 2 * cosh(k * h) / (ch * ch);
+				u[2 * npairs] = a + distance;
+				u[2 * npairs + 1] = b - distance;
+			}
+			(*func)(u, f, 2 * npairs, pars);
+			diag->evaluations += 2 * npairs;
+			for (int i = 0; i < npairs; i++)
+				sum += weight[i] * (f[2 * i] + f[2 * i + 1]);
+		}
+		double next = d * h * sum;
+		diag->error = fabs(next - integral);
+		diag->depth = level;
+		if (!isfinite(next) || (level > 0 && diag->error <= sqrt(eps) * fabs(next)))
+			return next;
+		integral = next;
+		h /= 2;
+	}
+	diag->exhausted = true;
+	return integral;
+}
+
+#ifndef SOMMERFELD_LIBRARY
+
+// Prints for the bound state of each X at a range of temperatures the number of evaluations
+// and the relative error of each rule with respect to Simpson's rule at a higher precision.
+void benchmark_quadrature(const SommerfeldContext *ctx)
+{
+	double xs[] = {1, 3, 10, 30, 100, 300, 1000, 3000, 10000};
+	int nxs = sizeof(xs) / sizeof(xs[0]);
+	double alpha_s = parton_alpha(GGscale);
+	printf("\n==== Quadrature of the bound state rates =====\n");
+	for (int integral = 0; integral < 2; integral++)
+	{
+		Integrand func = integral == 0 ? GammaDissIntegrand_batch : s_integrand_BSF_batch;
+		printf("\n%s: evaluations and relative error with respect to simpson(eps=1e-10)\n", integral == 0 ? "GammaDiss" : "sigmaBSFaveraged");
+		printf("%10s %8s", "pdg", "m/T");
+		for (int r = 0; r < NR_QUADRATURE_RULES; r++)
+			printf(" %10s %10s", quadrature_names[r], "error");
+		printf("\n");
+		long total[NR_QUADRATURE_RULES] = {0};
+		double max_error[NR_QUADRATURE_RULES] = {0};
+		int count = 0;
+		for (int i = 0; i < PARTICLE_REGISTRY_SIZE; i++)
+		{
+			const Particle *x = &ctx->particle_registry[i];
+			BoundStateParams bound_state = x->bound_state;
+			const BoundStateParams *bs = &bound_state;
+			if (x->pdg <= 0 || bs->m <= 0)
+				continue;
+			bound_state.alpha_s = alpha_s;
+			for (int j = 0; j < nxs; j++)
+			{
+				double T = bs->m / xs[j];
+				Parameters pars = {bs->spin, bs->color, bs->m, T, bs, Mcdm};
+				double upper = integral == 0 ? bs->energy / T / 4.0 / pow(bs->zeta, 2.0) : 1;
+				QuadratureDiagnostics reference_diag = {0};
+				double reference = simpsonArg(func, &pars, 0, upper, 1e-10, &reference_diag);
+				printf("%10ld %8g", x->pdg, xs[j]);
+				for (int r = 0; r < NR_QUADRATURE_RULES; r++)
+				{
+					// Gauss-Laguerre only applies to GammaDiss, as in parse_quadrature.
+					QuadratureRule rule = integral == 1 && r == QUADRATURE_GAUSS_LAGUERRE ? QUADRATURE_TANH_SINH : (QuadratureRule)r;
+					QuadratureDiagnostics diag;
+					double value = integrate(rule, func, &pars, 0, upper, QUADRATURE_EPS, &diag);
+					double error = reference != 0 ? fabs(value / reference - 1) : fabs(value);
+					printf(" %10ld %10.2e", diag.evaluations, error);
+					total[r] += diag.evaluations;
+					if (error > max_error[r])
+						max_error[r] = error;
+				}
+				printf("\n");
+				count++;
+			}
+		}
+		if (count == 0)
+			continue;
+		printf("%19s", "mean / max");
+		for (int r = 0; r < NR_QUADRATURE_RULES; r++)
+			printf(" %10.1f %10.2e", (double)total[r] / count, max_error[r]);
+		printf("\n");
+	}
+}
+
+
+/*-- Kernel Benchmark --*/
+
+void record_benchmark_sample(BenchmarkSampleList *list, BenchmarkSample sample)
+{
+	if (list->count == list->capacity)
+	{
+		int capacity = list->capacity > 0 ? 2 * list->capacity : 1024;
+		BenchmarkSample *samples = realloc(list->samples, capacity * sizeof(BenchmarkSample));
+		if (samples == NULL)
+			return;
+		list->samples = samples;
+		list->capacity = capacity;
+	}
+	list->samples[list->count++] = sample;
+}
+
+// Keeps max_count samples spread evenly over the run, such that their distribution is the one of the run.
+void thin_benchmark_samples(BenchmarkSampleList *list, int max_count)
+{
+	if (list->count <= max_count)
+		return;
+	for (int i = 0; i < max_count; i++)
+		list->samples[i] = list->samples[(long)i * list->count / max_count];
+	list->count = max_count;
+}
+
+double wall_time(void)
+{
+	struct timespec time;
+	clock_gettime(CLOCK_MONOTONIC, &time);
+	return time.tv_sec + 1e-9 * time.tv_nsec;
+}
+
+// Times func over passes of all n samples for at least BENCHMARK_MIN_TIME, the time includes the
+// call through the function pointer. Prints the result and adds it to the benchmarks of the JSON file.
+void run_benchmark(FILE *json, int *count, const char *name, BenchmarkFunction func, const BenchmarkInput *input, int n, bool kernel, double evaluations)
+{
+	double sum = 0.0;
+	long calls = 0;
+	double start = wall_time(), elapsed;
+	do
+	{
+		for (int i = 0; i < n; i++)
+			sum += func(input, i);
+		calls += n;
+		elapsed = wall_time() - start;
+	}
+	while (elapsed < BENCHMARK_MIN_TIME);
+	benchmark_sink = sum;
+	double ns = 1e9 * elapsed / calls;
+
+	if (kernel)
+		printf("%-18s %4d %4d %10s", name, input->spin, input->rep, input->sommerfeld ? "on" : "off");
+	else
+		printf("%-18s %4s %4s %10s", name, "", "", "");
+	printf(" %12.1f %12.4g", ns, 1e9 / ns);
+	if (evaluations > 0)
+		printf(" %12.1f\n", evaluations);
+	else
+		printf(" %12s\n", "-");
+
+	fprintf(json, "%s\t\t{\"function\": \"%s\"", *count > 0 ? ",\n" : "", name);
+	if (kernel)
+		fprintf(json, ", \"spin\": %d, \"rep\": %d, \"sommerfeld\": %s", input->spin, input->rep, input->sommerfeld ? "true" : "false");
+	fprintf(json, ", \"calls\": %ld, \"ns_per_call\": %.4g, \"calls_per_second\": %.6g", calls, ns, 1e9 / ns);
+	if (evaluations > 0)
+		fprintf(json, ", \"evaluations_per_integral\": %.1f", evaluations);
+	fprintf(json, "}");
+	(*count)++;
+}
+
+double benchmark_xx_to_qq(const BenchmarkInput *input, int i)
+{
+	return xx_to_qq(input->alpha_s, input->alpha_sommerfeld[i], input->rep, input->spin, input->m[i], input->v[i], input->sommerfeld);
+}
+
+double benchmark_xx_to_gg(const BenchmarkInput *input, int i)
+{
+	return xx_to_gg(input->alpha_s, input->alpha_sommerfeld[i], input->rep, input->spin, input->m[i], input->v[i], input->sommerfeld);
+}
+
+double benchmark_alpha_strong(const BenchmarkInput *input, int i)
+{
+	return alpha_strong(input->p[i]);
+}
+
+// The dissociation cross section is evaluated on nodes over the range of the integral of GammaDiss.
+double benchmark_sigma_diss(const BenchmarkInput *input, int i)
+{
+	int j = i / BENCHMARK_SIGMA_DISS_NODES;
+	return sigmaDiss(&input->bs[j], input->T[j], input->u[i]);
+}
+
+double benchmark_gamma_diss(const BenchmarkInput *input, int i)
+{
+	return GammaDiss(input->ctx, &input->bs[i], input->T[i]);
+}
+
+double benchmark_sigma_bsf_averaged(const BenchmarkInput *input, int i)
+{
+	return sigmaBSFaveraged(input->ctx, &input->bs[i], input->T[i], input->mdm[i]);
+}
+
+double benchmark_bound_state_rate(const BenchmarkInput *input, int i)
+{
+	return bound_state_rate(input->ctx, &input->bs[i], input->T[i], input->mdm[i]);
+}
+
+// Records the calls from micrOMEGAs during a freeze-out run with all corrections, and times the
+// kernels on their kinematics. The results are printed and written as JSON to output_name.
+int benchmark_kernels(SommerfeldContext *ctx, const char *output_name)
+{
+	printf("\n==== Benchmark of the kernels =====\n");
+	BenchmarkSamples samples = {{0}};
+	ctx->sommerfeld_on = ctx->bsf_on = true;
+	build_particle_registry(ctx);
+	ctx->benchmark_samples = &samples;
+	double Xf;
+	darkOmega(&Xf, 0, 1.E-7);
+	ctx->benchmark_samples = NULL;
+	double alpha_s = parton_alpha(GGscale);
+	printf("Freeze-out at Xf=%.4e with %d cross section and %d bound state calls\n", Xf, samples.xsec.count, samples.bsf.count);
+	FILE *json = NULL;
+	if (samples.xsec.count == 0 || samples.bsf.count == 0)
+		printf("WARNING: the freeze-out run has no calls to benchmark the kernels with\n");
+	else if ((json = fopen(output_name, "w")) == NULL)
+		printf("WARNING: can not write the benchmark to %s\n", output_name);
+	if (json == NULL)
+	{
+		free(samples.xsec.samples);
+		free(samples.bsf.samples);
+		return 1;
+	}
+	thin_benchmark_samples(&samples.xsec, BENCHMARK_XSEC_SAMPLES);
+	thin_benchmark_samples(&samples.bsf, BENCHMARK_BSF_SAMPLES);
+
+	// Kinematics of the cross sections, with alpha strong at the scale of the soft gluons.
+	int nxsec = samples.xsec.count;
+	double *m = malloc(4 * nxsec * sizeof(double));
+	double *v = m + nxsec, *p = v + nxsec, *alpha_sommerfeld = p + nxsec;
+	for (int i = 0; i < nxsec; i++)
+	{
+		m[i] = samples.xsec.samples[i].m;
+		p[i] = samples.xsec.samples[i].p;
+		v[i] = p[i] / sqrt(p[i] * p[i] + m[i] * m[i]);
+		alpha_sommerfeld[i] = alpha_strong(p[i]);
+	}
+
+	// Bound states and temperatures of the bound state rates, the calls were recorded for
+	// registered particles only.
+	int nbsf = samples.bsf.count;
+	BoundStateParams *bs = malloc(nbsf * sizeof(BoundStateParams));
+	double *T = malloc((2 + BENCHMARK_SIGMA_DISS_NODES) * nbsf * sizeof(double));
+	double *mdm = T + nbsf, *u = mdm + nbsf;
+	double gamma_diss_evaluations = 0.0, sigma_bsf_evaluations = 0.0;
+	for (int i = 0; i < nbsf; i++)
+	{
+		bs[i] = find_particle(ctx, samples.bsf.samples[i].pdg)->bound_state;
+		bs[i].alpha_s = alpha_s;
+		T[i] = samples.bsf.samples[i].T;
+		mdm[i] = samples.bsf.samples[i].mdm;
+		double upper_u = bs[i].energy / T[i] / 4.0 / pow(bs[i].zeta, 2.0);
+		for (int j = 0; j < BENCHMARK_SIGMA_DISS_NODES; j++)
+			u[i * BENCHMARK_SIGMA_DISS_NODES + j] = upper_u * (j + 0.5) / BENCHMARK_SIGMA_DISS_NODES;
+		// The evaluations of the integrals are counted outside of the timing.
+		Parameters pars = {bs[i].spin, bs[i].color, bs[i].m, T[i], &bs[i], mdm[i]};
+		QuadratureDiagnostics diag;
+		integrate(ctx->gamma_diss_quadrature, GammaDissIntegrand_batch, &pars, 0, upper_u, QUADRATURE_EPS, &diag);
+		gamma_diss_evaluations += (double)diag.evaluations / nbsf;
+		integrate(ctx->sigma_bsf_quadrature, s_integrand_BSF_batch, &pars, 0, 1, QUADRATURE_EPS, &diag);
+		sigma_bsf_evaluations += (double)diag.evaluations / nbsf;
+	}
+
+	fprintf(json, "{\n\t\"xf\": %.6e,\n\t\"mdm\": %.6e,\n", Xf, Mcdm);
+	fprintf(json, "\t\"quadrature\": {\"GammaDiss\": \"%s\", \"sigmaBSFaveraged\": \"%s\"},\n", quadrature_names[ctx->gamma_diss_quadrature], quadrature_names[ctx->sigma_bsf_quadrature]);
+	fprintf(json, "\t\"samples\": {\"cross_section\": %d, \"bound_state\": %d},\n", nxsec, nbsf);
+	fprintf(json, "\t\"benchmarks\": [\n");
+	printf("%-18s %4s %4s %10s %12s %12s %12s\n", "function", "spin", "rep", "sommerfeld", "ns/call", "calls/s", "evals/int");
+	int count = 0;
+	BenchmarkInput input = {ctx, 0, 0, false, alpha_s, m, v, p, alpha_sommerfeld, bs, T, mdm, u};
+	int reps[] = {3, 6, 8};
+	for (int gluons = 0; gluons < 2; gluons++)
+	{
+		for (input.spin = 1; input.spin <= 5; input.spin += 2)
+		{
+			for (int r = 0; r < 3; r++)
+			{
+				input.rep = reps[r];
+				for (int sommerfeld = 0; sommerfeld < 2; sommerfeld++)
+				{
+					input.sommerfeld = sommerfeld;
+					run_benchmark(json, &count, gluons ? "xx_to_gg" : "xx_to_qq", gluons ? benchmark_xx_to_gg : benchmark_xx_to_qq, &input, nxsec, true, 0.0);
+				}
+			}
+		}
+	}
+	run_benchmark(json, &count, "alpha_strong", benchmark_alpha_strong, &input, nxsec, false, 0.0);
+	run_benchmark(json, &count, "sigmaDiss", benchmark_sigma_diss, &input, nbsf * BENCHMARK_SIGMA_DISS_NODES, false, 0.0);
+	run_benchmark(json, &count, "GammaDiss", benchmark_gamma_diss, &input, nbsf, false, gamma_diss_evaluations);
+	run_benchmark(json, &count, "sigmaBSFaveraged", benchmark_sigma_bsf_averaged, &input, nbsf, false, sigma_bsf_evaluations);
+	run_benchmark(json, &count, "bound_state_rate", benchmark_bound_state_rate, &input, nbsf, false, gamma_diss_evaluations + sigma_bsf_evaluations);
+	fprintf(json, "\n\t]\n}\n");
+	fclose(json);
+	printf("Benchmark written to %s\n", output_name);
+
+	free(m);
+	free(bs);
+	free(T);
+	free(samples.xsec.samples);
+	free(samples.bsf.samples);
+	return 0;
+}
+
+#endif
+
+
+/*-- Library Interface --*/
+
+// The functions of sommerfeld.h, which only exist in the library.
+#ifdef SOMMERFELD_LIBRARY
+
+int sommerfeld_abi_version(void)
+{
+	return SOMMERFELD_ABI_VERSION;
+}
+
+int sommerfeld_init(void)
+{
+	build_alpha_strong_table();
+	build_gauss_laguerre();
+	return read_table_alpha() ? 0 : 1;
+}
+
+double sommerfeld_alpha_strong(double q)
+{
+	return alpha_strong(q);
+}
+
+double sommerfeld_xx_to_qq(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v)
+{
+	return xx_to_qq(alpha_s, alpha_sommerfeld, color, spin, m, v, sommerfeld != 0);
+}
+
+double sommerfeld_xx_to_gg(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v)
+{
+	return xx_to_gg(alpha_s, alpha_sommerfeld, color, spin, m, v, sommerfeld != 0);
+}
+
+void sommerfeld_xx_to_qq_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *out, long n)
+{
+	xsec_array(spin, color, sommerfeld != 0, false, alpha_s, alpha_sommerfeld, m, v, out, n);
+}
+
+void sommerfeld_xx_to_gg_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *out, long n)
+{
+	xsec_array(spin, color, sommerfeld != 0, true, alpha_s, alpha_sommerfeld, m, v, out, n);
+}
+
+// Resolves the kernel once and evaluates it for each point.
+void xsec_array(int spin, int color, bool sommerfeld, bool gluons, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *out, long n)
+{
+	XsecKernel kernel = xsec_kernel(spin, color, sommerfeld, gluons);
+	for (long i = 0; i < n; i++)
+		out[i] = kernel != NULL ? kernel(alpha_s[i], alpha_sommerfeld[i], m[i], v[i]) : 0.0;
+}
+
+void sommerfeld_xx_to_qq_waves(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v, double *waves)
+{
+	xx_to_qq_waves(alpha_s, alpha_sommerfeld, color, spin, m, v, sommerfeld != 0, waves);
+}
+
+void sommerfeld_xx_to_gg_waves(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v, double *waves)
+{
+	xx_to_gg_waves(alpha_s, alpha_sommerfeld, color, spin, m, v, sommerfeld != 0, waves);
+}
+
+void sommerfeld_xx_to_qq_waves_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *waves, long n)
+{
+	xsec_waves_array(spin, color, sommerfeld != 0, false, alpha_s, alpha_sommerfeld, m, v, waves, n);
+}
+
+void sommerfeld_xx_to_gg_waves_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *waves, long n)
+{
+	xsec_waves_array(spin, color, sommerfeld != 0, true, alpha_s, alpha_sommerfeld, m, v, waves, n);
+}
+
+// Validates spin and color once, so that an invalid process warns once instead of for each point.
+void xsec_waves_array(int spin, int color, bool sommerfeld, bool gluons, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *waves, long n)
+{
+	if (xsec_kernel(spin, color, sommerfeld, gluons) == NULL)
+	{
+		for (long i = 0; i < n * NR_PARTIAL_WAVES; i++)
+			waves[i] = 0.0;
+		return;
+	}
+	for (long i = 0; i < n; i++)
+	{
+		if (gluons)
+			xx_to_gg_waves(alpha_s[i], alpha_sommerfeld[i], color, spin, m[i], v[i], sommerfeld, waves + i * NR_PARTIAL_WAVES);
+		else
+			xx_to_qq_waves(alpha_s[i], alpha_sommerfeld[i], color, spin, m[i], v[i], sommerfeld, waves + i * NR_PARTIAL_WAVES);
+	}
+}
+
+SommerfeldContext *sommerfeld_context_new(void)
+{
+	SommerfeldContext *ctx = calloc(1, sizeof(SommerfeldContext));
+	if (ctx == NULL)
+		return NULL;
+	ctx->bsf_on = true;
+	ctx->gamma_diss_quadrature = ctx->sigma_bsf_quadrature = QUADRATURE_SIMPSON;
+	if (alpha_bs_table.values != NULL)
+		ctx->alpha_bs_table = &alpha_bs_table;
+	return ctx;
+}
+
+void sommerfeld_context_free(SommerfeldContext *ctx)
+{
+	if (ctx == NULL)
+		return;
+	free_sommerfeld_context(ctx);
+	free(ctx);
+}
+
+int sommerfeld_set_quadrature(SommerfeldContext *ctx, const char *name)
+{
+	return parse_quadrature(ctx, name) ? 0 : 1;
+}
+
+double sommerfeld_bound_state_rate(SommerfeldContext *ctx, int spin, int color, double m, double T, double mdm, double alpha_s)
+{
+	if (ctx->alpha_bs_table == NULL || (color != 3 && color != 6 && color != 8))
+		return 0.0;
+	BoundStateParams bs = bound_state_params(ctx, spin, color, m, alpha_s);
+	return bound_state_rate(ctx, &bs, T, mdm);
+}
+
+// exp(x) K0(x) and exp(x) K1(x) with the polynomial approximations of Abramowitz and Stegun
+// 9.8.1 to 9.8.8, which have a relative error below 1e-7.
+static double bessel_k0_scaled(double x)
+{
+	if (x > 2.0)
+	{
+		double y = 2.0 / x;
+		return (1.25331414 + y * (-0.7832358e-1 + y * (0.2189568e-1 + y * (-0.1062446e-1 + y * (0.587872e-2 + y * (-0.251540e-2 + y * 0.53208e-3)))))) / sqrt(x);
+	}
+	double t = x / 3.75, y = x * x / 4.0;
+	t *= t;
+	double i0 = 1.0 + t * (3.5156229 + t * (3.0899424 + t * (1.2067492 + t * (0.2659732 + t * (0.360768e-1 + t * 0.45813e-2)))));
+	double k0 = -log(x / 2.0) * i0 + (-0.57721566 + y * (0.42278420 + y * (0.23069756 + y * (0.3488590e-1 + y * (0.262698e-2 + y * (0.10750e-3 + y * 0.74e-5))))));
+	return exp(x) * k0;
+}
+
+static double bessel_k1_scaled(double x)
+{
+	if (x > 2.0)
+	{
+		double y = 2.0 / x;
+		return (1.25331414 + y * (0.23498619 + y * (-0.3655620e-1 + y * (0.1504268e-1 + y * (-0.780353e-2 + y * (0.325614e-2 + y * -0.68245e-3)))))) / sqrt(x);
+	}
+	double t = x / 3.75, y = x * x / 4.0;
+	t *= t;
+	double i1 = x * (0.5 + t * (0.87890594 + t * (0.51498869 + t * (0.15084934 + t * (0.2658733e-1 + t * (0.301532e-2 + t * 0.32411e-3))))));
+	double k1 = log(x / 2.0) * i1 + (1.0 + y * (0.15443144 + y * (-0.67278579 + y * (-0.18156897 + y * (-0.1919402e-1 + y * (-0.110404e-2 + y * -0.4686e-4)))))) / x;
+	return exp(x) * k1;
+}
+
+static double bessK1(double x)
+{
+	return exp(-x) * bessel_k1_scaled(x);
+}
+
+static double bessK2(double x)
+{
+	return exp(-x) * (bessel_k0_scaled(x) + 2.0 / x * bessel_k1_scaled(x));
+}
+
+// Integrand of the averaged formation cross section as in s_integrand_BSF_batch of the patched
+// omega.c, for a relic density without the exi option. The factor K1pol(T / sqrtS) of micrOMEGAs
+// is sqrt(2 z / pi) exp(z) K1(z) at z = sqrtS / T. This is a copy of the integrand in
+// micromegas_4.3.2_bound_states.patch, a change of either must be made to both.
+static void s_integrand_BSF_batch(const double *u, double *out, int n, const Parameters *pars)
+{
+	// The arrays below must not have zero length.
+	if (n <= 0)
+		return;
+	double uu[n], res0[n];
+	int inside[n];
+	for (int i = 0; i < n; i++)
+	{
+		uu[i] = 1.0;
+		res0[i] = 0.0;
+		inside[i] = 0;
+		if (u[i] == 0.0 || u[i] == 1.0)
+			continue;
+		double z = 1 - u[i] * u[i];
+		double sqrtS = 2 * pars->m - 3 * pars->T * log(z);
+		double y = sqrtS / pars->mdm;
+		double ms = 2 * pars->m;
+		if (ms >= sqrtS)
+			continue;
+		double PcmIn = sqrt((sqrtS - ms) * (sqrtS + ms)) / 2.0;
+		double vrel = 2 * PcmIn / sqrt(pow(PcmIn, 2.0) + pow(pars->m, 2.0));
+		uu[i] = 0.25 * pow(vrel, 2.0) * pars->m / pars->T;
+		double K1pol = sqrt(2 * sqrtS / (M_PI * pars->T)) * bessel_k1_scaled(sqrtS / pars->T);
+		res0[i] = sqrt(2 * y / M_PI) * y * (PcmIn * PcmIn / (pars->mdm * pars->mdm)) * 6 * u[i] * z * z * K1pol * sqrt(pars->mdm / pars->T);
+		inside[i] = 1;
+	}
+	// Nodes outside of the phase space are evaluated at uu = 1 and set to zero afterwards.
+	sigmaStimulatedBSF_batch(uu, out, n, pars);
+	for (int i = 0; i < n; i++)
+		out[i] = inside[i] ? out[i] * res0[i] : 0.0;
 }
 
+#endif
@@ -0,0 +1,93 @@
+/*--
+	libsommerfeld: (Sommerfeld-corrected) annihilation cross sections of colored
+	particles and their bound state formation rate, see main_micromegas.c.
+
+	The library is main_micromegas.c compiled with SOMMERFELD_LIBRARY defined,
+	which leaves out the main program and everything else which uses micrOMEGAs.
+	It only needs the math library, and is built next to main_micromegas.c and
+	this header with
+		gcc -O2 -fPIC -shared -DSOMMERFELD_LIBRARY main_micromegas.c -o libsommerfeld.so -lm
+	or as a static library with
+		gcc -c -O2 -DSOMMERFELD_LIBRARY main_micromegas.c -o sommerfeld.o
+		ar rcs libsommerfeld.a sommerfeld.o
+	in which case programs link it with -lsommerfeld -lm. sommerfeld_native.py
+	finds libsommerfeld.so in its own folder. The bound state rate is that of
+	the patched micrOMEGAs for a relic density without the exi option.
+
+	Spins are coded as in the PDG number of the particles of the model: 1 for
+	scalars, 3 for fermions and 5 for vectors. Colors are 3, 6 or 8.
+
+	The functions may be called from several threads at once after
+	sommerfeld_init, as long as each thread uses its own context. The library
+	writes no files and nothing to the standard output, its warnings go to
+	stderr.
+--*/
+
+#ifndef SOMMERFELD_H
+#define SOMMERFELD_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Version of this interface, which is increased whenever a function of the interface changes.
+#define SOMMERFELD_ABI_VERSION 2
+
+// Number of partial waves l = 0, 1, ... of the partial wave functions.
+#define SOMMERFELD_NR_WAVES 5
+
+// Caches and settings of the bound state rates, a context must only be used by one thread at once.
+typedef struct SommerfeldContext SommerfeldContext;
+
+// Returns the version of the interface of the library, compare it to SOMMERFELD_ABI_VERSION.
+int sommerfeld_abi_version(void);
+
+// Tabulates alpha strong and reads the table of alpha strong for bound states from the working
+// directory, alpha_strong_bsf.bin if the main program has converted it and alpha_strong_bsf.txt
+// otherwise. Call it once before any other function.
+// Returns 0 on success and 1 if the table for bound states can not be read, the cross
+// sections and alpha strong can be used in either case.
+int sommerfeld_init(void);
+
+// Alpha strong at the scale q in GeV, as used for the Sommerfeld corrections.
+double sommerfeld_alpha_strong(double q);
+
+// Cross sections in GeV^-2 of XX -> qq (summed over flavors) and XX -> gg, as they replace those
+// of micrOMEGAs, for X's with mass m and velocity v in the center of mass frame. The hard process
+// has coupling alpha_s and the soft gluons alpha_sommerfeld, which is ignored without Sommerfeld
+// corrections. Returns 0 for an invalid spin or color.
+double sommerfeld_xx_to_qq(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v);
+double sommerfeld_xx_to_gg(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v);
+
+// Cross sections for n points at once, with the arguments above given as arrays. The output is
+// zero for an invalid spin or color.
+void sommerfeld_xx_to_qq_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *out, long n);
+void sommerfeld_xx_to_gg_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *out, long n);
+
+// Partial waves l = 0, ..., SOMMERFELD_NR_WAVES - 1 of the cross sections above, written to waves.
+// The cross sections above are the sum of the partial waves up to l = 2. The array variants write
+// the partial waves of point i to waves[i * SOMMERFELD_NR_WAVES + l]. The waves are zero for an
+// invalid spin or color.
+void sommerfeld_xx_to_qq_waves(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v, double *waves);
+void sommerfeld_xx_to_gg_waves(int spin, int color, int sommerfeld, double alpha_s, double alpha_sommerfeld, double m, double v, double *waves);
+void sommerfeld_xx_to_qq_waves_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *waves, long n);
+void sommerfeld_xx_to_gg_waves_array(int spin, int color, int sommerfeld, const double *alpha_s, const double *alpha_sommerfeld, const double *m, const double *v, double *waves, long n);
+
+// Creates a context with Simpson's rule for the bound state rates, or returns NULL.
+SommerfeldContext *sommerfeld_context_new(void);
+void sommerfeld_context_free(SommerfeldContext *ctx);
+
+// Selects the quadrature rule for the bound state rates: "simpson", "laguerre" or "tanh-sinh".
+// Returns 0 on success and 1 for an unknown rule.
+int sommerfeld_set_quadrature(SommerfeldContext *ctx, const char *name);
+
+// Thermally averaged bound state formation rate of XX with mass m at temperature T, for
+// dark matter with mass mdm and alpha_s for the emitted gluon. Returns 0 for an invalid color
+// or if the table of alpha strong for bound states was not read.
+double sommerfeld_bound_state_rate(SommerfeldContext *ctx, int spin, int color, double m, double T, double mdm, double alpha_s);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -1,7 +1,12 @@
 #! /usr/bin/env python
 
+import os
 import sys
+import stat
+import math
+import select
 import argparse
+import multiprocessing
 import mpmath
 
 
@@ -9,212 +14,229 @@ import mpmath
 # xsec functions #
 ##################
 
+# cross section of the process and color representation up to the lth partial wave
 def get_xsec(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld):
-	if process == 'sstoqq':
-		if rep == 3:
-			return xsec_sstoqq_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_sstoqq_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_sstoqq_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
+	waves = wave_functions.get((process, rep))
+	if waves is None:
 		return 0.0
+	return sum(waves(sommerfeld, m, v, alphas, alphasommerfeld)[:l + 1])
 
-	if process == 'sstogg':
-		if rep == 3:
-			return xsec_sstogg_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_sstogg_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_sstogg_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0;
-
-	if process == 'fftoqq':
-		if rep == 3:
-			return xsec_fftoqq_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_fftoqq_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_fftoqq_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	if process == 'fftogg':
-		if rep == 3:
-			return xsec_fftogg_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_fftogg_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_fftogg_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	if process == 'vvtoqq':
-		if rep == 3:
-			return xsec_vvtoqq_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_vvtoqq_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_vvtoqq_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	if process == 'vvtogg':
-		if rep == 3:
-			return xsec_vvtogg_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_vvtogg_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_vvtogg_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	return 0.0
-	
-
-def xsec_sstoqq_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+# the partial waves l = 0, ..., 4 of the cross sections, the functions of mpmath are an argument
+# such that the adaptive precision evaluates the same expressions with bounded floats
+def waves_sstoqq_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [0.0, ((2.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-2.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [0.0, ((1.0 / 11664.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))), ((-1.0 / 46656.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [0.0, ((2.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-2.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [0.0, ((1.0 / 11664.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))), ((-1.0 / 46656.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
 
-def xsec_sstoqq_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstoqq_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [0.0, ((5.0 / 54.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-5.0 / 54.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [0.0, ((55.0 / 46656.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((-55.0 / 186624.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [0.0, ((5.0 / 54.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-5.0 / 54.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [0.0, ((55.0 / 46656.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((-55.0 / 186624.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
 
-def xsec_sstoqq_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstoqq_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [0.0, ((1.0 / 16.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-1.0 / 16.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [0.0, ((3.0 / 512.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((-3.0 / 2048.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [0.0, ((1.0 / 16.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-1.0 / 16.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [0.0, ((3.0 / 512.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((-3.0 / 2048.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
 	
 
-def xsec_sstogg_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstogg_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((7.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-40.0 / 81.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((143.0 / 405.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((1.0 / 162.0) * ((-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 7776.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((768.0 * mpmath.power(v, 2.0)) + (mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (96.0 + mpmath.power(alphasommerfeld, 2.0))) + (160.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (512.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((-1.0 / 151165440.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((7.0 * ((-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (1.0 + (-1.0 * mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((82944.0 * mpmath.power(v, 4.0)) + (-720.0 * mpmath.power(v, 2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0)))) + (16384.0 * ((81.0 * mpmath.power(v, 4.0)) + (-45.0 * mpmath.power(v, 2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (4.0 * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0)))))) + (80.0 * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (1024.0 * mpmath.power(((-8.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (8.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (8748.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (1.0 + (-1.0 * mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * (mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (41472.0 * mpmath.power(v, 4.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (16.0 * mpmath.fabs((24.0 + ((320.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((256.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((7.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-40.0 / 81.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((143.0 / 405.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((1.0 / 162.0) * ((-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 7776.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((768.0 * mpmath.power(v, 2.0)) + (mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (96.0 + mpmath.power(alphasommerfeld, 2.0))) + (160.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (512.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((-1.0 / 151165440.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((7.0 * ((-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (1.0 + (-1.0 * mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((82944.0 * mpmath.power(v, 4.0)) + (-720.0 * mpmath.power(v, 2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0)))) + (16384.0 * ((81.0 * mpmath.power(v, 4.0)) + (-45.0 * mpmath.power(v, 2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (4.0 * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0)))))) + (80.0 * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (1024.0 * mpmath.power(((-8.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (8.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (8748.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (1.0 + (-1.0 * mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * (mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (41472.0 * mpmath.power(v, 4.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (16.0 * mpmath.fabs((24.0 + ((320.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((256.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
-def xsec_sstogg_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstogg_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((155.0 / 108.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-260.0 / 81.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((911.0 / 324.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((1.0 / 648.0) * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 31104.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-24000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-17952.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (15552.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-6655.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (10368.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((4.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-17248.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-16000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((-1.0 / 1866240.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-28.0 * mpmath.power(v, 2.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (64.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((-8000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (-320.0 * mpmath.power(v, 2.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * mpmath.power((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + ((-2000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-50.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (50.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (1485.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-128.0 * mpmath.power(v, 2.0) * ((32.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((243.0 + ((90.0 + (-90.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (2.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((2000.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((10000.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((155.0 / 108.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-260.0 / 81.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((911.0 / 324.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((1.0 / 648.0) * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 31104.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-24000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-17952.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (15552.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-6655.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (10368.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((4.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-17248.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-16000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((-1.0 / 1866240.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-28.0 * mpmath.power(v, 2.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (64.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((-8000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (-320.0 * mpmath.power(v, 2.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * mpmath.power((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + ((-2000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-50.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (50.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (1485.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-128.0 * mpmath.power(v, 2.0) * ((32.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((243.0 + ((90.0 + (-90.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (2.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((2000.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((10000.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
-def xsec_sstogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstogg_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((27.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-15.0 / 8.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((261.0 / 160.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((27.0 / 64.0) * (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((9.0 / 1024.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-48.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-32.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-9.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (-32.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (-16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * (3.0 + (2.0 * mpmath.fabs((2.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))))) + (-32.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((-3.0 / 20480.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-28.0 * mpmath.power(v, 2.0) * ((mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)))) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0))))))) + (20.0 * mpmath.power(v, -2.0) * ((16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (2.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (2.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (27.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-128.0 * mpmath.power(v, 2.0) * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((20.0 + (-20.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + (180.0 * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((27.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-15.0 / 8.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((261.0 / 160.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((27.0 / 64.0) * (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((9.0 / 1024.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-48.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-32.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-9.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (-32.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (-16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * (3.0 + (2.0 * mpmath.fabs((2.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))))) + (-32.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((-3.0 / 20480.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-28.0 * mpmath.power(v, 2.0) * ((mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)))) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0))))))) + (20.0 * mpmath.power(v, -2.0) * ((16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (2.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (2.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (27.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-128.0 * mpmath.power(v, 2.0) * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((20.0 + (-20.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + (180.0 * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
 
-def xsec_fftoqq_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftoqq_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((1.0 / 9.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-4.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((-1.0 / 54.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 324.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (6.0 + mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))))), ((-1.0 / 8957952.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (mpmath.power(alphasommerfeld, 4.0) + (-2.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (24.0 + mpmath.power(alphasommerfeld, 2.0))) + (mpmath.power(v, 4.0) * (13824.0 + (48.0 * mpmath.power(alphasommerfeld, 2.0)) + mpmath.power(alphasommerfeld, 4.0))) + (1728.0 * mpmath.power(v, 4.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((1.0 / 9.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-4.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((-1.0 / 54.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 324.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (6.0 + mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))))), ((-1.0 / 8957952.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (mpmath.power(alphasommerfeld, 4.0) + (-2.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (24.0 + mpmath.power(alphasommerfeld, 2.0))) + (mpmath.power(v, 4.0) * (13824.0 + (48.0 * mpmath.power(alphasommerfeld, 2.0)) + mpmath.power(alphasommerfeld, 4.0))) + (1728.0 * mpmath.power(v, 4.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))), 0., 0.]
 
-def xsec_fftoqq_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftoqq_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((5.0 / 36.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-5.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((5.0 / 108.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((-55.0 / 216.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((55.0 / 1296.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (6.0 + mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))))), ((-55.0 / 35831808.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((14641.0 * mpmath.power(alphasommerfeld, 4.0)) + (-242.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (24.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power(v, 4.0) * (13824.0 + (5808.0 * mpmath.power(alphasommerfeld, 2.0)) + (14641.0 * mpmath.power(alphasommerfeld, 4.0)))) + (1728.0 * mpmath.power(v, 4.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((5.0 / 36.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-5.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((5.0 / 108.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((-55.0 / 216.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((55.0 / 1296.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (6.0 + mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))))), ((-55.0 / 35831808.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((14641.0 * mpmath.power(alphasommerfeld, 4.0)) + (-242.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (24.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power(v, 4.0) * (13824.0 + (5808.0 * mpmath.power(alphasommerfeld, 2.0)) + (14641.0 * mpmath.power(alphasommerfeld, 4.0)))) + (1728.0 * mpmath.power(v, 4.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))), 0., 0.]
 
-def xsec_fftoqq_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftoqq_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((3.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-1.0 / 8.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((-9.0 / 64.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((3.0 / 128.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (6.0 + mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))))), ((-3.0 / 131072.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((243.0 * mpmath.power(alphasommerfeld, 4.0)) + (-18.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (8.0 + (27.0 * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power(v, 4.0) * (512.0 + (144.0 * mpmath.power(alphasommerfeld, 2.0)) + (243.0 * mpmath.power(alphasommerfeld, 4.0)))) + (64.0 * mpmath.power(v, 4.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((3.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-1.0 / 8.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((-9.0 / 64.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((3.0 / 128.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * (6.0 + mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))))), ((-3.0 / 131072.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((243.0 * mpmath.power(alphasommerfeld, 4.0)) + (-18.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (8.0 + (27.0 * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power(v, 4.0) * (512.0 + (144.0 * mpmath.power(alphasommerfeld, 2.0)) + (243.0 * mpmath.power(alphasommerfeld, 4.0)))) + (64.0 * mpmath.power(v, 4.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))), 0., 0.]
 
 
-def xsec_fftogg_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftogg_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((7.0 / 54.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((5.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-23.0 / 90.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((1.0 / 324.0) * ((-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 34992.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((256.0 * ((-7.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (7.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-11.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-1044.0 + (11.0 * mpmath.power(alphasommerfeld, 2.0)))) + (90.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (288.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((1.0 / 604661760.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (5.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-99.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))) + (-360.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (-10.0 * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (1024.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-8.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (8.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-2.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((16384.0 * ((81.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0)) + (-45.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (4.0 * mpmath.power(alphasommerfeld, 4.0)))) + (5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * (mpmath.power(alphasommerfeld, 4.0) + (-2.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (-360.0 + mpmath.power(alphasommerfeld, 2.0))) + (mpmath.power(v, 4.0) * (82944.0 + (-720.0 * mpmath.power(alphasommerfeld, 2.0)) + mpmath.power(alphasommerfeld, 4.0))))))) + (-7776.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-8640.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (256.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-4.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (4.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (11664.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((320.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((256.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((7.0 / 54.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((5.0 / 27.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-23.0 / 90.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((1.0 / 324.0) * ((-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 34992.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((256.0 * ((-7.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (7.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-11.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-1044.0 + (11.0 * mpmath.power(alphasommerfeld, 2.0)))) + (90.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (288.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((1.0 / 604661760.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (5.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-99.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))) + (-360.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (-10.0 * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (1024.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-8.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (8.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-2.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((16384.0 * ((81.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0)) + (-45.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (4.0 * mpmath.power(alphasommerfeld, 4.0)))) + (5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * (mpmath.power(alphasommerfeld, 4.0) + (-2.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (-360.0 + mpmath.power(alphasommerfeld, 2.0))) + (mpmath.power(v, 4.0) * (82944.0 + (-720.0 * mpmath.power(alphasommerfeld, 2.0)) + mpmath.power(alphasommerfeld, 4.0))))))) + (-7776.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-8640.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (256.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-4.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (4.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (11664.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((320.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((256.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
-def xsec_fftogg_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftogg_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((155.0 / 216.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((85.0 / 108.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-119.0 / 72.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((1.0 / 1296.0) * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 62208.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((48.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)))) + (48.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((6655.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (7920.0 + (-6655.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-28.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (-144.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((2000.0 / 9.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (8.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((4.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((1.0 / 268738560.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-605.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-2200.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (72.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (288.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (64.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((-8000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (1440.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * mpmath.power((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + ((-2000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-50.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (50.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-47520.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-960.0 * mpmath.power(v, 2.0) * ((-2304.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((9.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (8000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (1296.0 * mpmath.power(v, 4.0) * ((32.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((243.0 + ((90.0 + (-90.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (2.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((2000.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((10000.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((155.0 / 216.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((85.0 / 108.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-119.0 / 72.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((1.0 / 1296.0) * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 62208.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((48.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)))) + (48.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((6655.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (7920.0 + (-6655.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-28.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (-144.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((2000.0 / 9.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (8.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((4.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((1.0 / 268738560.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-605.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-2200.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (72.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (288.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (64.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((-8000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (1440.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * mpmath.power((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + ((-2000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-50.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (50.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-47520.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-960.0 * mpmath.power(v, 2.0) * ((-2304.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((9.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (8000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (1296.0 * mpmath.power(v, 4.0) * ((32.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((243.0 + ((90.0 + (-90.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (2.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((2000.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((10000.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
-def xsec_fftogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftogg_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((27.0 / 64.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((15.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-309.0 / 320.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((27.0 / 128.0) * (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((-9.0 / 512.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-7.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (7.0 * mpmath.power(alphasommerfeld, 2.0)))) + (2.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))))) + (mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-36.0 * mpmath.power(v, 2.0)) + (20.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (16.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (-81.0 * mpmath.power(alphasommerfeld, 2.0)) + (18.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (63.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-18.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-63.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-2.0 * (-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (-2.0 * (-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((3.0 / 327680.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-11.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-64.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-40.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (32.0 * mpmath.power(v, 4.0) * ((mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)))) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0))))))) + (-10.0 * ((16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (2.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (2.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-96.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-960.0 * mpmath.power(v, 2.0) * ((4.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (4.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (144.0 * mpmath.power(v, 4.0) * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((20.0 + (-20.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + (180.0 * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((27.0 / 64.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((15.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((-309.0 / 320.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((27.0 / 128.0) * (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((-9.0 / 512.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-7.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (7.0 * mpmath.power(alphasommerfeld, 2.0)))) + (2.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))))) + (mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-36.0 * mpmath.power(v, 2.0)) + (20.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (16.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (-81.0 * mpmath.power(alphasommerfeld, 2.0)) + (18.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (63.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-18.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-63.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-2.0 * (-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (-2.0 * (-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((3.0 / 327680.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-11.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-64.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-40.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (32.0 * mpmath.power(v, 4.0) * ((mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)))) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0))))))) + (-10.0 * ((16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (2.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (2.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-96.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-960.0 * mpmath.power(v, 2.0) * ((4.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (4.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (144.0 * mpmath.power(v, 4.0) * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((20.0 + (-20.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + (180.0 * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
 
-def xsec_vvtoqq_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtoqq_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [0.0, ((2.0 / 9.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((2.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [0.0, ((1.0 / 3888.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))), ((1.0 / 419904.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [0.0, ((2.0 / 9.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((2.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [0.0, ((1.0 / 3888.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))), ((1.0 / 419904.0) * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
 
-def xsec_vvtoqq_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtoqq_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [0.0, ((5.0 / 18.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((5.0 / 486.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [0.0, ((55.0 / 15552.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((55.0 / 1679616.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [0.0, ((5.0 / 18.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((5.0 / 486.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [0.0, ((55.0 / 15552.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((55.0 / 1679616.0) * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
 
-def xsec_vvtoqq_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtoqq_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [0.0, ((3.0 / 16.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1.0 / 144.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [0.0, ((9.0 / 512.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((1.0 / 6144.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [0.0, ((3.0 / 16.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1.0 / 144.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [0.0, ((9.0 / 512.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))), ((1.0 / 6144.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))), 0., 0.]
 
 
-def xsec_vvtogg_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtogg_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((133.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((8.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((67.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((19.0 / 1458.0) * ((-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 209952.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((256.0 * ((-32.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (99.0 + (32.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-97.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-288.0 + (97.0 * mpmath.power(alphasommerfeld, 2.0)))) + (-1440.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (-4608.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((1.0 / 453496320.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (5.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-60.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))) + (-480.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (-80.0 * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (1024.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-8.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (8.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-27.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((16384.0 * ((81.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0)) + (-45.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (4.0 * mpmath.power(alphasommerfeld, 4.0)))) + (5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * (mpmath.power(alphasommerfeld, 4.0) + (-2.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (-360.0 + mpmath.power(alphasommerfeld, 2.0))) + (mpmath.power(v, 4.0) * (82944.0 + (-720.0 * mpmath.power(alphasommerfeld, 2.0)) + mpmath.power(alphasommerfeld, 4.0))))))) + (-972.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-1440.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (256.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-4.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (4.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (6912.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((320.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((256.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((133.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((8.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((67.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((19.0 / 1458.0) * ((-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 209952.0) * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((256.0 * ((-32.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (99.0 + (32.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-97.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-288.0 + (97.0 * mpmath.power(alphasommerfeld, 2.0)))) + (-1440.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (-4608.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))), ((1.0 / 453496320.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (5.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-60.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0))))) + (-480.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (-80.0 * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (72.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (1024.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-8.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (8.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-27.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((16384.0 * ((81.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0)) + (-45.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * mpmath.power(alphasommerfeld, 2.0)) + (4.0 * mpmath.power(alphasommerfeld, 4.0)))) + (5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * (-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * (mpmath.power(alphasommerfeld, 4.0) + (-2.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0) * (-360.0 + mpmath.power(alphasommerfeld, 2.0))) + (mpmath.power(v, 4.0) * (82944.0 + (-720.0 * mpmath.power(alphasommerfeld, 2.0)) + mpmath.power(alphasommerfeld, 4.0))))))) + (-972.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-1440.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (256.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-4.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (4.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((16.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (6912.0 * mpmath.power(v, 4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -2.0) * ((-5.0 * mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp(((-1.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((5.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((1.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-16.0 * mpmath.power((-1.0 + mpmath.exp(((-4.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((320.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((256.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
-def xsec_vvtogg_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtogg_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((2945.0 / 972.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-200.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1103.0 / 972.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((19.0 / 5832.0) * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 279936.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((912.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)))) + (912.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-1045.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-96.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (-144.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((2000.0 / 9.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (-96.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((4.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((1.0 / 151165440.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-275.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-2200.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (72.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (2916.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (64.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((-8000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (8640.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * mpmath.power((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + ((-2000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-50.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (50.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-4455.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-120.0 * mpmath.power(v, 2.0) * ((-2304.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((9.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (8000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (576.0 * mpmath.power(v, 4.0) * ((32.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((243.0 + ((90.0 + (-90.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (2.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((2000.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((10000.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((2945.0 / 972.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-200.0 / 243.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((1103.0 / 972.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((19.0 / 5832.0) * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((1.0 / 279936.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (3.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((912.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)))) + (912.0 * ((-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0)) + (324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0)) + (-1045.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-96.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (-144.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((2000.0 / 9.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -2.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (-96.0 * mpmath.power(v, 2.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), -1.0) * ((324.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((4.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((2.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((1.0 / 151165440.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-275.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-576.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-2200.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (72.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (2916.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (64.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0))))) + ((-8000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-36.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0)))))))) + (8640.0 * mpmath.power(v, 4.0) * ((539.0 * mpmath.power((1.0 + (-1.0 * mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * mpmath.power((2.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + ((-2000.0 / 81.0) * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * mpmath.power(((-50.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (9.0 + (50.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-4455.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-120.0 * mpmath.power(v, 2.0) * ((-2304.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((9.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-121.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-144.0 + (121.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((121.0 / 36.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (8000.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-25.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-9.0 + (25.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((100.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (576.0 * mpmath.power(v, 4.0) * ((32.0 * mpmath.power((-1.0 + mpmath.exp(((2.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((243.0 + ((90.0 + (-90.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (2.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-539.0 * mpmath.power((-1.0 + mpmath.exp(((-11.0 / 6.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((605.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((14641.0 / 1296.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-500.0 * mpmath.power((-1.0 + mpmath.exp(((-10.0 / 3.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((2000.0 / 9.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + ((10000.0 / 81.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
 
-def xsec_vvtogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtogg_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [((57.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-11.0 / 24.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((65.0 / 96.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
-	else:
-		wave_list = [((57.0 / 64.0) * (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((-1.0 / 1024.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-48.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (11.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0)))) + (-2.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))))) + (mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((752.0 * mpmath.power(v, 2.0)) + (-224.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (-528.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (-1251.0 * mpmath.power(alphasommerfeld, 2.0)) + (387.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (864.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (1251.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-387.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-864.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (96.0 * (-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (96.0 * (-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((1.0 / 61440.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-5.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-64.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-40.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (324.0 * mpmath.power(v, 4.0) * ((mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)))) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0))))))) + (-60.0 * ((16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (2.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (2.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-9.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-120.0 * mpmath.power(v, 2.0) * ((4.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (4.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (64.0 * mpmath.power(v, 4.0) * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((20.0 + (-20.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + (180.0 * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
-	return sum(wave_list[:l + 1])
+		return [((57.0 / 32.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power(alphas, 2.0)), ((-11.0 / 24.0) * mpmath.power(m, -2.0) * mpmath.pi * v * mpmath.power(alphas, 2.0)), ((65.0 / 96.0) * mpmath.power(m, -2.0) * mpmath.pi * mpmath.power(v, 3.0) * mpmath.power(alphas, 2.0)), 0., 0.]
+	return [((57.0 / 64.0) * (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0))) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld), ((-1.0 / 1024.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-48.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-2.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (11.0 + (2.0 * mpmath.power(alphasommerfeld, 2.0)))) + (-2.0 * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))))) + (mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((752.0 * mpmath.power(v, 2.0)) + (-224.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (-528.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0)) + (-1251.0 * mpmath.power(alphasommerfeld, 2.0)) + (387.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (864.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(alphasommerfeld, 2.0)) + (1251.0 * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-387.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (-864.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power(v, 2.0) * mpmath.power(alphasommerfeld, 2.0)) + (96.0 * (-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (96.0 * (-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))) * mpmath.power(v, 2.0) * mpmath.fabs((2.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))))), ((1.0 / 61440.0) * mpmath.power(m, -2.0) * mpmath.power(mpmath.pi, 2.0) * mpmath.power(v, -2.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * mpmath.power(alphas, 2.0) * alphasommerfeld * ((-5.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-64.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0)))))) + (-40.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (324.0 * mpmath.power(v, 4.0) * ((mpmath.power((1.0 + (-1.0 * mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((9.0 / 4.0) * (-1.0 + mpmath.power(v, -2.0)) * mpmath.power(alphasommerfeld, 2.0)))) + (mpmath.power((1.0 + (-1.0 * mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)))), -1.0) * (4.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))) * (16.0 + ((-9.0 + (9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)))) + (-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, -4.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + mpmath.power(alphasommerfeld, 2.0)))) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0))))))) + (-60.0 * ((16.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power((mpmath.power(alphasommerfeld, 2.0) + (-1.0 * mpmath.power(v, 2.0) * (2.0 + mpmath.power(alphasommerfeld, 2.0)))), 2.0)) + (16.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (2.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (8.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))), 2.0)))) + (-9.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.power(v, 2.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))) + (-120.0 * mpmath.power(v, 2.0) * ((4.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 + (-9.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (4.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-1.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-4.0 + mpmath.power(alphasommerfeld, 2.0)))) * mpmath.fabs((4.0 + ((1.0 + (-1.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0))))) + (mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * ((-9.0 * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, 2.0) * (-16.0 + (9.0 * mpmath.power(alphasommerfeld, 2.0))))) * mpmath.fabs((4.0 + ((9.0 / 4.0) * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0))))))) + (64.0 * mpmath.power(v, 4.0) * ((-1.0 * mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld)) * mpmath.power((-1.0 + mpmath.exp((-1.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((20.0 + (-20.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + (mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp(((-3.0 / 2.0) * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + ((45.0 + (-45.0 * mpmath.power(v, -2.0))) * mpmath.power(alphasommerfeld, 2.0)) + ((81.0 / 16.0) * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))) + (-1.0 * mpmath.power((-1.0 + mpmath.exp((-3.0 * mpmath.pi * mpmath.power(v, -1.0) * mpmath.power((1.0 + (-1.0 * mpmath.power(v, 2.0))), (1.0 / 2.0)) * alphasommerfeld))), -1.0) * mpmath.fabs((24.0 + (180.0 * mpmath.power(v, -2.0) * (-1.0 + mpmath.power(v, 2.0)) * mpmath.power(alphasommerfeld, 2.0)) + (81.0 * mpmath.power(v, -4.0) * mpmath.power((-1.0 + mpmath.power(v, 2.0)), 2.0) * mpmath.power(alphasommerfeld, 4.0))))))))), 0., 0.]
+
+# the waves functions by process and color representation
+wave_functions = dict(((process, rep), globals()['waves_' + process + '_' + str(rep)]) for process in ['sstoqq', 'sstogg', 'fftoqq', 'fftogg', 'vvtoqq', 'vvtogg'] for rep in [3, 6, 8])
+
+
+######################
+# adaptive precision #
+######################
+
+# Floating point number with a bound on its absolute error, which is propagated through the
+# arithmetic of the xsec functions (running error analysis). Every operation adds the rounding
+# error of its result, the constants in the expressions are taken as exact.
+unit_roundoff = 2.0 ** -53
+underflow = 2.0 ** -1074
+
+class BoundedFloat(object):
+	__slots__ = ['x', 'error']
+
+	def __init__(self, x, error):
+		self.x = x
+		self.error = error
+
+	def __neg__(self):
+		return BoundedFloat(-self.x, self.error)
+
+	def __add__(self, other):
+		if not isinstance(other, BoundedFloat):
+			return rounded(self.x + other, self.error)
+		return rounded(self.x + other.x, self.error + other.error)
+
+	def __sub__(self, other):
+		return self + (-other)
+
+	def __rsub__(self, other):
+		return (-self) + other
+
+	def __mul__(self, other):
+		if not isinstance(other, BoundedFloat):
+			return rounded(self.x * other, abs(other) * self.error)
+		return rounded(self.x * other.x, abs(self.x) * other.error + abs(other.x) * self.error + self.error * other.error)
+
+	def __div__(self, other):
+		if not isinstance(other, BoundedFloat):
+			return rounded(self.x / other, self.error / abs(other))
+		if abs(other.x) <= other.error:
+			raise ZeroDivisionError('division by a number which may be zero')
+		x = self.x / other.x
+		return rounded(x, (self.error + abs(x) * other.error) / (abs(other.x) - other.error))
+
+	def __rdiv__(self, other):
+		return BoundedFloat(other, 0.0) / self
+
+	__radd__ = __add__
+	__rmul__ = __mul__
+	__truediv__ = __div__
+	__rtruediv__ = __rdiv__
+
+def rounded(x, error):
+	return BoundedFloat(x, error + unit_roundoff * abs(x) + underflow)
+
+def bounded(x):
+	return x if isinstance(x, BoundedFloat) else BoundedFloat(x, 0.0)
+
+# the functions of mpmath which the xsec functions use, for bounded floats
+class bounded_math(object):
+	pi = BoundedFloat(math.pi, unit_roundoff * math.pi)
+
+	@staticmethod
+	def exp(a):
+		a = bounded(a)
+		x = math.exp(a.x)
+		return rounded(x, x * math.expm1(a.error))
+
+	@staticmethod
+	def fabs(a):
+		a = bounded(a)
+		return BoundedFloat(abs(a.x), a.error)
+
+	# the exponents in the expressions are constants
+	@staticmethod
+	def power(a, p):
+		a = bounded(a)
+		x = math.pow(a.x, p)
+		if a.x == 0.0:
+			if p <= 0.0:
+				raise ZeroDivisionError('negative power of a number which may be zero')
+			return rounded(x, a.error ** p)
+		relative = a.error / abs(a.x)
+		if p < 0.0 and relative >= 1.0:
+			raise ZeroDivisionError('negative power of a number which may be zero')
+		return rounded(x, abs(x) * abs((1.0 + (relative if p > 0.0 else -relative)) ** p - 1.0))
+
+# cross section as the sum of its partial waves, each evaluated in double precision with a bound
+# on its error. The waves whose error exceeds their share of the tolerance on the sum (cancellations)
+# are evaluated again with mpmath at the precision which makes up for the bits lost, the others are
+# kept.
+def get_xsec_adaptive(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld, tolerance):
+	wave_function = wave_functions.get((process, rep))
+	if wave_function is None or l < 0:
+		return mpmath.mpf(0.0)
+	exact = [mpmath.mpf(x) for x in [m, v, alphas, alphasommerfeld]]
+	variables = [BoundedFloat(float(x), unit_roundoff * abs(float(x))) for x in [m, v, alphas, alphasommerfeld]]
+	def reevaluate(prec):
+		with mpmath.workprec(max(prec, mpmath.mp.prec)):
+			return wave_function(sommerfeld, *exact)[:l + 1]
+	try:
+		waves = [bounded(wave) for wave in wave_function(sommerfeld, *variables, mpmath=bounded_math)[:l + 1]]
+	except (OverflowError, ZeroDivisionError, ValueError):
+		waves = reevaluate(4 * 53)
+	# the share of each wave shrinks as the waves evaluated again refine the sum
+	while True:
+		xsec = mpmath.fsum(wave.x if isinstance(wave, BoundedFloat) else wave for wave in waves)
+		budget = tolerance * abs(float(xsec)) / len(waves)
+		offending = [i for i, wave in enumerate(waves) if isinstance(wave, BoundedFloat) and wave.error > budget]
+		if not offending:
+			return xsec
+		prec = max(int(math.log(waves[i].error / (unit_roundoff * budget), 2)) + 16 for i in offending) if budget > 0.0 else 4 * 53
+		exact_waves = reevaluate(prec)
+		for i in offending:
+			waves[i] = exact_waves[i]
 
 
 ###############
@@ -223,23 +245,112 @@ def xsec_vvtogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
 
 # argument parser
 parser = argparse.ArgumentParser(description='Returns the cross section (in 1/GeV^2) of the annihilation process for a given partial wave.')
-parser.add_argument('-p', '--process', action='store', required=True, help='the annihilation process (sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg)')
-parser.add_argument('-r', '--rep', action='store', required=True, help='the color representation of the annihilating particle (3, 6 or 8)')
-parser.add_argument('-v', '--vars', nargs=4, required=True, help='the variables the cross section depends on: m, v, alpha_s, alpha_sommerfeld')
+parser.add_argument('-p', '--process', action='store', required=True, help='the annihilation process (sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg), several are separated by commas')
+parser.add_argument('-r', '--rep', action='store', required=True, help='the color representation of the annihilating particle (3, 6 or 8), several are separated by commas')
+variables = parser.add_mutually_exclusive_group(required=True)
+variables.add_argument('-v', '--vars', nargs=4, help='the variables the cross section depends on: m, v, alpha_s, alpha_sommerfeld')
+variables.add_argument('-b', '--batch', nargs='?', const='-', help='read the variables m, v, alpha_s, alpha_sommerfeld from the rows of this file (default: stdin), separated by whitespace or commas, and write each row followed by its cross sections')
 parser.add_argument('-s', '--sommerfeld', action='store_true', help='add sommerfeld corrections (default: off)')
 parser.add_argument('-l', '--lwave', action='store', default=2, help='corrections up to the lth partial wave (default l = 2)')
 parser.add_argument('-e', '--extended', action='store_true', help='Extended logging of the results')
+parser.add_argument('-j', '--jobs', action='store', type=int, default=1, help='number of processes which evaluate the rows in batch mode (default: 1)')
+backends = parser.add_mutually_exclusive_group()
+backends.add_argument('--reference', action='store_true', help='evaluate with mpmath at arbitrary precision instead of with the compiled cross sections of libsommerfeld (see sommerfeld_native.py)')
+backends.add_argument('-a', '--adaptive', nargs='?', type=float, const=1e-12, help='evaluate in double precision with a bound on the rounding error and again with mpmath at the precision needed if the relative error may exceed this tolerance (default: 1e-12)')
 args = parser.parse_args()
 
-# determine the process and representation
-process = args.process
-if not process in ['sstoqq', 'sstogg', 'fftoqq', 'fftogg', 'vvtoqq', 'vvtogg']:
-	print "Process " + process + " is not known, must be sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg."
-	sys.exit(2)
-rep = int(args.rep)
-if not rep in [3, 6, 8]:
-	print "Color representation " + str(rep) + " is not valid, must be 3, 6, or 8."
-	sys.exit(2)
+# determine the processes and representations
+processes = args.process.split(',')
+for process in processes:
+	if not process in ['sstoqq', 'sstogg', 'fftoqq', 'fftogg', 'vvtoqq', 'vvtogg']:
+		print "Process " + process + " is not known, must be sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg."
+		sys.exit(2)
+reps = [int(rep) for rep in args.rep.split(',')]
+for rep in reps:
+	if not rep in [3, 6, 8]:
+		print "Color representation " + str(rep) + " is not valid, must be 3, 6, or 8."
+		sys.exit(2)
+combinations = [(process, rep) for process in processes for rep in reps]
+
+# determine partial wave and sommerfeld
+l = int(args.lwave);
+sommerfeld = args.sommerfeld
+
+# determine the backend, the compiled partial waves are used unless the reference or adaptive precision is asked for
+native = None
+if not args.reference and args.adaptive is None:
+	try:
+		import sommerfeld_native
+		sommerfeld_native.load_library()
+		native = sommerfeld_native
+	except (ImportError, OSError) as error:
+		sys.stderr.write("Compiled cross sections are not available, using mpmath: " + str(error) + "\n")
+
+# cross sections of all combinations for rows of the variables m, v, alpha_s and alpha_sommerfeld
+# (as strings), returns for each row the list of its cross sections (floats with the compiled ones)
+def evaluate(rows):
+	xsecs = []
+	columns = [[float(x) for x in column] for column in zip(*rows)]
+	for process, rep in combinations:
+		if native is not None:
+			xsecs.append(native.get_xsec(process, rep, l, sommerfeld, *columns).tolist())
+		elif args.adaptive is not None:
+			xsecs.append([get_xsec_adaptive(process, rep, l, sommerfeld, *(list(row) + [args.adaptive])) for row in rows])
+		else:
+			xsecs.append([get_xsec(process, rep, l, sommerfeld, *[mpmath.mpf(x) for x in row]) for row in rows])
+	return zip(*xsecs)
+
+# evaluates a chunk of the batch input and returns the output lines
+def evaluate_chunk(chunk):
+	xsecs = evaluate([fields for fields, separator in chunk])
+	return [separator.join(fields + ['%.15g' % xsec for xsec in row]) + '\n' for (fields, separator), row in zip(chunk, xsecs)]
+
+# reads the rows of the batch input in chunks of (fields, separator), rows which are not four numbers are skipped;
+# from a pipe or terminal a chunk is also returned when no further row is available yet, such that rows which
+# arrive one by one are answered right away
+def read_chunks(batch_file, size):
+	streaming = not stat.S_ISREG(os.fstat(batch_file.fileno()).st_mode)
+	chunk = []
+	for line in iter(batch_file.readline, ''):
+		line = line.strip()
+		if not line or line.startswith('#'):
+			continue
+		separator = ',' if ',' in line else ' '
+		fields = [field.strip() for field in line.split(',')] if separator == ',' else line.split()
+		try:
+			if len(fields) != 4:
+				raise ValueError
+			[float(field) for field in fields]
+		except ValueError:
+			sys.stderr.write("Skipping row which is not m, v, alpha_s, alpha_sommerfeld: " + line + "\n")
+			continue
+		chunk.append((fields, separator))
+		if len(chunk) == size or (streaming and not select.select([batch_file], [], [], 0)[0]):
+			yield chunk
+			chunk = []
+	if chunk:
+		yield chunk
+
+# batch mode: stream the cross sections of each row, the compiled cross sections evaluate
+# whole chunks of rows at once while mpmath evaluates the rows one by one (in chunks with
+# adaptive precision, which are cheap enough that the chunks save on the jobs' overhead)
+if args.batch is not None:
+	batch_file = sys.stdin if args.batch == '-' else open(args.batch)
+	sys.stdout.write("# m v alpha_s alpha_sommerfeld " + " ".join([process + "_" + str(rep) for process, rep in combinations]) + "\n")
+	chunks = read_chunks(batch_file, 1024 if native is not None else (64 if args.adaptive is not None else 1))
+	pool = None
+	if args.jobs > 1:
+		pool = multiprocessing.Pool(args.jobs)
+		results = pool.imap(evaluate_chunk, chunks)
+	else:
+		results = (evaluate_chunk(chunk) for chunk in chunks)
+	for lines in results:
+		sys.stdout.writelines(lines)
+		sys.stdout.flush()
+	if pool is not None:
+		pool.close()
+		pool.join()
+	sys.exit(0)
 
 # determine variables
 m = mpmath.mpf(args.vars[0])
@@ -247,18 +358,15 @@ v = mpmath.mpf(args.vars[1])
 alphas = mpmath.mpf(args.vars[2])
 alphasommerfeld = mpmath.mpf(args.vars[3])
 
-# determine partial wave and sommerfeld
-l = int(args.lwave);
-sommerfeld = args.sommerfeld
+# determine the cross sections
+xsecs = [mpmath.mpf(xsec) for xsec in evaluate([args.vars])[0]]
 
-# determine the cross section
-xsec = get_xsec(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld);
-
-# print the result
-if args.extended:
-	print "Annihilation cross section for " + process + " with color representation " + str(rep)
-	print "and m = " + str(m) + ", v = " + str(v) + ", alpha_s = " + str(alphas) + ", alpha_sommerfeld = " + str(alphasommerfeld)
-	print "and for l = " + str(l) + " and sommerfeld " + str(sommerfeld) + " equals:"
-	print "\t" + mpmath.nstr(xsec, 15)
-else:
-	print mpmath.nstr(xsec, 15)
+# print the results
+for (process, rep), xsec in zip(combinations, xsecs):
+	if args.extended:
+		print "Annihilation cross section for " + process + " with color representation " + str(rep)
+		print "and m = " + str(m) + ", v = " + str(v) + ", alpha_s = " + str(alphas) + ", alpha_sommerfeld = " + str(alphasommerfeld)
+		print "and for l = " + str(l) + " and sommerfeld " + str(sommerfeld) + " equals:"
+		print "\t" + mpmath.nstr(xsec, 15)
+	else:
+		print mpmath.nstr(xsec, 15)
@@ -1,7 +1,12 @@
 #! /usr/bin/env python
 
+import os
 import sys
+import stat
+import math
+import select
 import argparse
+import multiprocessing
 import mpmath
 
 
@@ -9,212 +14,229 @@ import mpmath
 # xsec functions #
 ##################
 
+# cross section of the process and color representation up to the lth partial wave
 def get_xsec(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld):
-	if process == 'sstoqq':
-		if rep == 3:
-			return xsec_sstoqq_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_sstoqq_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_sstoqq_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
+	waves = wave_functions.get((process, rep))
+	if waves is None:
 		return 0.0
+	return sum(waves(sommerfeld, m, v, alphas, alphasommerfeld)[:l + 1])
 
-	if process == 'sstogg':
-		if rep == 3:
-			return xsec_sstogg_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_sstogg_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_sstogg_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0;
-
-	if process == 'fftoqq':
-		if rep == 3:
-			return xsec_fftoqq_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_fftoqq_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_fftoqq_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	if process == 'fftogg':
-		if rep == 3:
-			return xsec_fftogg_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_fftogg_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_fftogg_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	if process == 'vvtoqq':
-		if rep == 3:
-			return xsec_vvtoqq_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_vvtoqq_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_vvtoqq_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	if process == 'vvtogg':
-		if rep == 3:
-			return xsec_vvtogg_3(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 6:
-			return xsec_vvtogg_6(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		if rep == 8:
-			return xsec_vvtogg_8(l, sommerfeld, m, v, alphas, alphasommerfeld)
-		return 0.0
-
-	return 0.0
-	
-
-def xsec_sstoqq_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+# the partial waves l = 0, ..., 4 of the cross sections, the functions of mpmath are an argument
+# such that the adaptive precision evaluates the same expressions with bounded floats
+def waves_sstoqq_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_S3S3_QQ_NS_L0, ID_S3S3_QQ_NS_L1, ID_S3S3_QQ_NS_L2, ID_S3S3_QQ_NS_L3, ID_S3S3_QQ_NS_L4]
-	else:
-		wave_list = [ID_S3S3_QQ_SO_L0, ID_S3S3_QQ_SO_L1, ID_S3S3_QQ_SO_L2, ID_S3S3_QQ_SO_L3, ID_S3S3_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_S3S3_QQ_NS_L0, ID_S3S3_QQ_NS_L1, ID_S3S3_QQ_NS_L2, ID_S3S3_QQ_NS_L3, ID_S3S3_QQ_NS_L4]
+	return [ID_S3S3_QQ_SO_L0, ID_S3S3_QQ_SO_L1, ID_S3S3_QQ_SO_L2, ID_S3S3_QQ_SO_L3, ID_S3S3_QQ_SO_L4]
 
-def xsec_sstoqq_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstoqq_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_S6S6_QQ_NS_L0, ID_S6S6_QQ_NS_L1, ID_S6S6_QQ_NS_L2, ID_S6S6_QQ_NS_L3, ID_S6S6_QQ_NS_L4]
-	else:
-		wave_list = [ID_S6S6_QQ_SO_L0, ID_S6S6_QQ_SO_L1, ID_S6S6_QQ_SO_L2, ID_S6S6_QQ_SO_L3, ID_S6S6_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_S6S6_QQ_NS_L0, ID_S6S6_QQ_NS_L1, ID_S6S6_QQ_NS_L2, ID_S6S6_QQ_NS_L3, ID_S6S6_QQ_NS_L4]
+	return [ID_S6S6_QQ_SO_L0, ID_S6S6_QQ_SO_L1, ID_S6S6_QQ_SO_L2, ID_S6S6_QQ_SO_L3, ID_S6S6_QQ_SO_L4]
 
-def xsec_sstoqq_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstoqq_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_S8S8_QQ_NS_L0, ID_S8S8_QQ_NS_L1, ID_S8S8_QQ_NS_L2, ID_S8S8_QQ_NS_L3, ID_S8S8_QQ_NS_L4]
-	else:
-		wave_list = [ID_S8S8_QQ_SO_L0, ID_S8S8_QQ_SO_L1, ID_S8S8_QQ_SO_L2, ID_S8S8_QQ_SO_L3, ID_S8S8_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_S8S8_QQ_NS_L0, ID_S8S8_QQ_NS_L1, ID_S8S8_QQ_NS_L2, ID_S8S8_QQ_NS_L3, ID_S8S8_QQ_NS_L4]
+	return [ID_S8S8_QQ_SO_L0, ID_S8S8_QQ_SO_L1, ID_S8S8_QQ_SO_L2, ID_S8S8_QQ_SO_L3, ID_S8S8_QQ_SO_L4]
 	
 
-def xsec_sstogg_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstogg_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_S3S3_GG_NS_L0, ID_S3S3_GG_NS_L1, ID_S3S3_GG_NS_L2, ID_S3S3_GG_NS_L3, ID_S3S3_GG_NS_L4]
-	else:
-		wave_list = [ID_S3S3_GG_SO_L0, ID_S3S3_GG_SO_L1, ID_S3S3_GG_SO_L2, ID_S3S3_GG_SO_L3, ID_S3S3_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_S3S3_GG_NS_L0, ID_S3S3_GG_NS_L1, ID_S3S3_GG_NS_L2, ID_S3S3_GG_NS_L3, ID_S3S3_GG_NS_L4]
+	return [ID_S3S3_GG_SO_L0, ID_S3S3_GG_SO_L1, ID_S3S3_GG_SO_L2, ID_S3S3_GG_SO_L3, ID_S3S3_GG_SO_L4]
 
-def xsec_sstogg_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstogg_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_S6S6_GG_NS_L0, ID_S6S6_GG_NS_L1, ID_S6S6_GG_NS_L2, ID_S6S6_GG_NS_L3, ID_S6S6_GG_NS_L4]
-	else:
-		wave_list = [ID_S6S6_GG_SO_L0, ID_S6S6_GG_SO_L1, ID_S6S6_GG_SO_L2, ID_S6S6_GG_SO_L3, ID_S6S6_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_S6S6_GG_NS_L0, ID_S6S6_GG_NS_L1, ID_S6S6_GG_NS_L2, ID_S6S6_GG_NS_L3, ID_S6S6_GG_NS_L4]
+	return [ID_S6S6_GG_SO_L0, ID_S6S6_GG_SO_L1, ID_S6S6_GG_SO_L2, ID_S6S6_GG_SO_L3, ID_S6S6_GG_SO_L4]
 
-def xsec_sstogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_sstogg_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_S8S8_GG_NS_L0, ID_S8S8_GG_NS_L1, ID_S8S8_GG_NS_L2, ID_S8S8_GG_NS_L3, ID_S8S8_GG_NS_L4]
-	else:
-		wave_list = [ID_S8S8_GG_SO_L0, ID_S8S8_GG_SO_L1, ID_S8S8_GG_SO_L2, ID_S8S8_GG_SO_L3, ID_S8S8_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_S8S8_GG_NS_L0, ID_S8S8_GG_NS_L1, ID_S8S8_GG_NS_L2, ID_S8S8_GG_NS_L3, ID_S8S8_GG_NS_L4]
+	return [ID_S8S8_GG_SO_L0, ID_S8S8_GG_SO_L1, ID_S8S8_GG_SO_L2, ID_S8S8_GG_SO_L3, ID_S8S8_GG_SO_L4]
 
 
-def xsec_fftoqq_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftoqq_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_F3F3_QQ_NS_L0, ID_F3F3_QQ_NS_L1, ID_F3F3_QQ_NS_L2, ID_F3F3_QQ_NS_L3, ID_F3F3_QQ_NS_L4]
-	else:
-		wave_list = [ID_F3F3_QQ_SO_L0, ID_F3F3_QQ_SO_L1, ID_F3F3_QQ_SO_L2, ID_F3F3_QQ_SO_L3, ID_F3F3_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_F3F3_QQ_NS_L0, ID_F3F3_QQ_NS_L1, ID_F3F3_QQ_NS_L2, ID_F3F3_QQ_NS_L3, ID_F3F3_QQ_NS_L4]
+	return [ID_F3F3_QQ_SO_L0, ID_F3F3_QQ_SO_L1, ID_F3F3_QQ_SO_L2, ID_F3F3_QQ_SO_L3, ID_F3F3_QQ_SO_L4]
 
-def xsec_fftoqq_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftoqq_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_F6F6_QQ_NS_L0, ID_F6F6_QQ_NS_L1, ID_F6F6_QQ_NS_L2, ID_F6F6_QQ_NS_L3, ID_F6F6_QQ_NS_L4]
-	else:
-		wave_list = [ID_F6F6_QQ_SO_L0, ID_F6F6_QQ_SO_L1, ID_F6F6_QQ_SO_L2, ID_F6F6_QQ_SO_L3, ID_F6F6_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_F6F6_QQ_NS_L0, ID_F6F6_QQ_NS_L1, ID_F6F6_QQ_NS_L2, ID_F6F6_QQ_NS_L3, ID_F6F6_QQ_NS_L4]
+	return [ID_F6F6_QQ_SO_L0, ID_F6F6_QQ_SO_L1, ID_F6F6_QQ_SO_L2, ID_F6F6_QQ_SO_L3, ID_F6F6_QQ_SO_L4]
 
-def xsec_fftoqq_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftoqq_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_F8F8_QQ_NS_L0, ID_F8F8_QQ_NS_L1, ID_F8F8_QQ_NS_L2, ID_F8F8_QQ_NS_L3, ID_F8F8_QQ_NS_L4]
-	else:
-		wave_list = [ID_F8F8_QQ_SO_L0, ID_F8F8_QQ_SO_L1, ID_F8F8_QQ_SO_L2, ID_F8F8_QQ_SO_L3, ID_F8F8_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_F8F8_QQ_NS_L0, ID_F8F8_QQ_NS_L1, ID_F8F8_QQ_NS_L2, ID_F8F8_QQ_NS_L3, ID_F8F8_QQ_NS_L4]
+	return [ID_F8F8_QQ_SO_L0, ID_F8F8_QQ_SO_L1, ID_F8F8_QQ_SO_L2, ID_F8F8_QQ_SO_L3, ID_F8F8_QQ_SO_L4]
 
 
-def xsec_fftogg_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftogg_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_F3F3_GG_NS_L0, ID_F3F3_GG_NS_L1, ID_F3F3_GG_NS_L2, ID_F3F3_GG_NS_L3, ID_F3F3_GG_NS_L4]
-	else:
-		wave_list = [ID_F3F3_GG_SO_L0, ID_F3F3_GG_SO_L1, ID_F3F3_GG_SO_L2, ID_F3F3_GG_SO_L3, ID_F3F3_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_F3F3_GG_NS_L0, ID_F3F3_GG_NS_L1, ID_F3F3_GG_NS_L2, ID_F3F3_GG_NS_L3, ID_F3F3_GG_NS_L4]
+	return [ID_F3F3_GG_SO_L0, ID_F3F3_GG_SO_L1, ID_F3F3_GG_SO_L2, ID_F3F3_GG_SO_L3, ID_F3F3_GG_SO_L4]
 
-def xsec_fftogg_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftogg_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_F6F6_GG_NS_L0, ID_F6F6_GG_NS_L1, ID_F6F6_GG_NS_L2, ID_F6F6_GG_NS_L3, ID_F6F6_GG_NS_L4]
-	else:
-		wave_list = [ID_F6F6_GG_SO_L0, ID_F6F6_GG_SO_L1, ID_F6F6_GG_SO_L2, ID_F6F6_GG_SO_L3, ID_F6F6_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_F6F6_GG_NS_L0, ID_F6F6_GG_NS_L1, ID_F6F6_GG_NS_L2, ID_F6F6_GG_NS_L3, ID_F6F6_GG_NS_L4]
+	return [ID_F6F6_GG_SO_L0, ID_F6F6_GG_SO_L1, ID_F6F6_GG_SO_L2, ID_F6F6_GG_SO_L3, ID_F6F6_GG_SO_L4]
 
-def xsec_fftogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_fftogg_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_F8F8_GG_NS_L0, ID_F8F8_GG_NS_L1, ID_F8F8_GG_NS_L2, ID_F8F8_GG_NS_L3, ID_F8F8_GG_NS_L4]
-	else:
-		wave_list = [ID_F8F8_GG_SO_L0, ID_F8F8_GG_SO_L1, ID_F8F8_GG_SO_L2, ID_F8F8_GG_SO_L3, ID_F8F8_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_F8F8_GG_NS_L0, ID_F8F8_GG_NS_L1, ID_F8F8_GG_NS_L2, ID_F8F8_GG_NS_L3, ID_F8F8_GG_NS_L4]
+	return [ID_F8F8_GG_SO_L0, ID_F8F8_GG_SO_L1, ID_F8F8_GG_SO_L2, ID_F8F8_GG_SO_L3, ID_F8F8_GG_SO_L4]
 
 
-def xsec_vvtoqq_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtoqq_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_V3V3_QQ_NS_L0, ID_V3V3_QQ_NS_L1, ID_V3V3_QQ_NS_L2, ID_V3V3_QQ_NS_L3, ID_V3V3_QQ_NS_L4]
-	else:
-		wave_list = [ID_V3V3_QQ_SO_L0, ID_V3V3_QQ_SO_L1, ID_V3V3_QQ_SO_L2, ID_V3V3_QQ_SO_L3, ID_V3V3_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_V3V3_QQ_NS_L0, ID_V3V3_QQ_NS_L1, ID_V3V3_QQ_NS_L2, ID_V3V3_QQ_NS_L3, ID_V3V3_QQ_NS_L4]
+	return [ID_V3V3_QQ_SO_L0, ID_V3V3_QQ_SO_L1, ID_V3V3_QQ_SO_L2, ID_V3V3_QQ_SO_L3, ID_V3V3_QQ_SO_L4]
 
-def xsec_vvtoqq_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtoqq_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_V6V6_QQ_NS_L0, ID_V6V6_QQ_NS_L1, ID_V6V6_QQ_NS_L2, ID_V6V6_QQ_NS_L3, ID_V6V6_QQ_NS_L4]
-	else:
-		wave_list = [ID_V6V6_QQ_SO_L0, ID_V6V6_QQ_SO_L1, ID_V6V6_QQ_SO_L2, ID_V6V6_QQ_SO_L3, ID_V6V6_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_V6V6_QQ_NS_L0, ID_V6V6_QQ_NS_L1, ID_V6V6_QQ_NS_L2, ID_V6V6_QQ_NS_L3, ID_V6V6_QQ_NS_L4]
+	return [ID_V6V6_QQ_SO_L0, ID_V6V6_QQ_SO_L1, ID_V6V6_QQ_SO_L2, ID_V6V6_QQ_SO_L3, ID_V6V6_QQ_SO_L4]
 
-def xsec_vvtoqq_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtoqq_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_V8V8_QQ_NS_L0, ID_V8V8_QQ_NS_L1, ID_V8V8_QQ_NS_L2, ID_V8V8_QQ_NS_L3, ID_V8V8_QQ_NS_L4]
-	else:
-		wave_list = [ID_V8V8_QQ_SO_L0, ID_V8V8_QQ_SO_L1, ID_V8V8_QQ_SO_L2, ID_V8V8_QQ_SO_L3, ID_V8V8_QQ_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_V8V8_QQ_NS_L0, ID_V8V8_QQ_NS_L1, ID_V8V8_QQ_NS_L2, ID_V8V8_QQ_NS_L3, ID_V8V8_QQ_NS_L4]
+	return [ID_V8V8_QQ_SO_L0, ID_V8V8_QQ_SO_L1, ID_V8V8_QQ_SO_L2, ID_V8V8_QQ_SO_L3, ID_V8V8_QQ_SO_L4]
 
 
-def xsec_vvtogg_3(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtogg_3(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_V3V3_GG_NS_L0, ID_V3V3_GG_NS_L1, ID_V3V3_GG_NS_L2, ID_V3V3_GG_NS_L3, ID_V3V3_GG_NS_L4]
-	else:
-		wave_list = [ID_V3V3_GG_SO_L0, ID_V3V3_GG_SO_L1, ID_V3V3_GG_SO_L2, ID_V3V3_GG_SO_L3, ID_V3V3_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_V3V3_GG_NS_L0, ID_V3V3_GG_NS_L1, ID_V3V3_GG_NS_L2, ID_V3V3_GG_NS_L3, ID_V3V3_GG_NS_L4]
+	return [ID_V3V3_GG_SO_L0, ID_V3V3_GG_SO_L1, ID_V3V3_GG_SO_L2, ID_V3V3_GG_SO_L3, ID_V3V3_GG_SO_L4]
 
-def xsec_vvtogg_6(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtogg_6(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_V6V6_GG_NS_L0, ID_V6V6_GG_NS_L1, ID_V6V6_GG_NS_L2, ID_V6V6_GG_NS_L3, ID_V6V6_GG_NS_L4]
-	else:
-		wave_list = [ID_V6V6_GG_SO_L0, ID_V6V6_GG_SO_L1, ID_V6V6_GG_SO_L2, ID_V6V6_GG_SO_L3, ID_V6V6_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_V6V6_GG_NS_L0, ID_V6V6_GG_NS_L1, ID_V6V6_GG_NS_L2, ID_V6V6_GG_NS_L3, ID_V6V6_GG_NS_L4]
+	return [ID_V6V6_GG_SO_L0, ID_V6V6_GG_SO_L1, ID_V6V6_GG_SO_L2, ID_V6V6_GG_SO_L3, ID_V6V6_GG_SO_L4]
 
-def xsec_vvtogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
-	wave_list = []
+def waves_vvtogg_8(sommerfeld, m, v, alphas, alphasommerfeld, mpmath=mpmath):
 	if not sommerfeld:
-		wave_list = [ID_V8V8_GG_NS_L0, ID_V8V8_GG_NS_L1, ID_V8V8_GG_NS_L2, ID_V8V8_GG_NS_L3, ID_V8V8_GG_NS_L4]
-	else:
-		wave_list = [ID_V8V8_GG_SO_L0, ID_V8V8_GG_SO_L1, ID_V8V8_GG_SO_L2, ID_V8V8_GG_SO_L3, ID_V8V8_GG_SO_L4]
-	return sum(wave_list[:l + 1])
+		return [ID_V8V8_GG_NS_L0, ID_V8V8_GG_NS_L1, ID_V8V8_GG_NS_L2, ID_V8V8_GG_NS_L3, ID_V8V8_GG_NS_L4]
+	return [ID_V8V8_GG_SO_L0, ID_V8V8_GG_SO_L1, ID_V8V8_GG_SO_L2, ID_V8V8_GG_SO_L3, ID_V8V8_GG_SO_L4]
+
+# the waves functions by process and color representation
+wave_functions = dict(((process, rep), globals()['waves_' + process + '_' + str(rep)]) for process in ['sstoqq', 'sstogg', 'fftoqq', 'fftogg', 'vvtoqq', 'vvtogg'] for rep in [3, 6, 8])
+
+
+######################
+# adaptive precision #
+######################
+
+# Floating point number with a bound on its absolute error, which is propagated through the
+# arithmetic of the xsec functions (running error analysis). Every operation adds the rounding
+# error of its result, the constants in the expressions are taken as exact.
+unit_roundoff = 2.0 ** -53
+underflow = 2.0 ** -1074
+
+class BoundedFloat(object):
+	__slots__ = ['x', 'error']
+
+	def __init__(self, x, error):
+		self.x = x
+		self.error = error
+
+	def __neg__(self):
+		return BoundedFloat(-self.x, self.error)
+
+	def __add__(self, other):
+		if not isinstance(other, BoundedFloat):
+			return rounded(self.x + other, self.error)
+		return rounded(self.x + other.x, self.error + other.error)
+
+	def __sub__(self, other):
+		return self + (-other)
+
+	def __rsub__(self, other):
+		return (-self) + other
+
+	def __mul__(self, other):
+		if not isinstance(other, BoundedFloat):
+			return rounded(self.x * other, abs(other) * self.error)
+		return rounded(self.x * other.x, abs(self.x) * other.error + abs(other.x) * self.error + self.error * other.error)
+
+	def __div__(self, other):
+		if not isinstance(other, BoundedFloat):
+			return rounded(self.x / other, self.error / abs(other))
+		if abs(other.x) <= other.error:
+			raise ZeroDivisionError('division by a number which may be zero')
+		x = self.x / other.x
+		return rounded(x, (self.error + abs(x) * other.error) / (abs(other.x) - other.error))
+
+	def __rdiv__(self, other):
+		return BoundedFloat(other, 0.0) / self
+
+	__radd__ = __add__
+	__rmul__ = __mul__
+	__truediv__ = __div__
+	__rtruediv__ = __rdiv__
+
+def rounded(x, error):
+	return BoundedFloat(x, error + unit_roundoff * abs(x) + underflow)
+
+def bounded(x):
+	return x if isinstance(x, BoundedFloat) else BoundedFloat(x, 0.0)
+
+# the functions of mpmath which the xsec functions use, for bounded floats
+class bounded_math(object):
+	pi = BoundedFloat(math.pi, unit_roundoff * math.pi)
+
+	@staticmethod
+	def exp(a):
+		a = bounded(a)
+		x = math.exp(a.x)
+		return rounded(x, x * math.expm1(a.error))
+
+	@staticmethod
+	def fabs(a):
+		a = bounded(a)
+		return BoundedFloat(abs(a.x), a.error)
+
+	# the exponents in the expressions are constants
+	@staticmethod
+	def power(a, p):
+		a = bounded(a)
+		x = math.pow(a.x, p)
+		if a.x == 0.0:
+			if p <= 0.0:
+				raise ZeroDivisionError('negative power of a number which may be zero')
+			return rounded(x, a.error ** p)
+		relative = a.error / abs(a.x)
+		if p < 0.0 and relative >= 1.0:
+			raise ZeroDivisionError('negative power of a number which may be zero')
+		return rounded(x, abs(x) * abs((1.0 + (relative if p > 0.0 else -relative)) ** p - 1.0))
+
+# cross section as the sum of its partial waves, each evaluated in double precision with a bound
+# on its error. The waves whose error exceeds their share of the tolerance on the sum (cancellations)
+# are evaluated again with mpmath at the precision which makes up for the bits lost, the others are
+# kept.
+def get_xsec_adaptive(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld, tolerance):
+	wave_function = wave_functions.get((process, rep))
+	if wave_function is None or l < 0:
+		return mpmath.mpf(0.0)
+	exact = [mpmath.mpf(x) for x in [m, v, alphas, alphasommerfeld]]
+	variables = [BoundedFloat(float(x), unit_roundoff * abs(float(x))) for x in [m, v, alphas, alphasommerfeld]]
+	def reevaluate(prec):
+		with mpmath.workprec(max(prec, mpmath.mp.prec)):
+			return wave_function(sommerfeld, *exact)[:l + 1]
+	try:
+		waves = [bounded(wave) for wave in wave_function(sommerfeld, *variables, mpmath=bounded_math)[:l + 1]]
+	except (OverflowError, ZeroDivisionError, ValueError):
+		waves = reevaluate(4 * 53)
+	# the share of each wave shrinks as the waves evaluated again refine the sum
+	while True:
+		xsec = mpmath.fsum(wave.x if isinstance(wave, BoundedFloat) else wave for wave in waves)
+		budget = tolerance * abs(float(xsec)) / len(waves)
+		offending = [i for i, wave in enumerate(waves) if isinstance(wave, BoundedFloat) and wave.error > budget]
+		if not offending:
+			return xsec
+		prec = max(int(math.log(waves[i].error / (unit_roundoff * budget), 2)) + 16 for i in offending) if budget > 0.0 else 4 * 53
+		exact_waves = reevaluate(prec)
+		for i in offending:
+			waves[i] = exact_waves[i]
 
 
 ###############
@@ -223,23 +245,112 @@ def xsec_vvtogg_8(l, sommerfeld, m, v, alphas, alpha_sommerfeld):
 
 # argument parser
 parser = argparse.ArgumentParser(description='Returns the cross section (in 1/GeV^2) of the annihilation process for a given partial wave.')
-parser.add_argument('-p', '--process', action='store', required=True, help='the annihilation process (sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg)')
-parser.add_argument('-r', '--rep', action='store', required=True, help='the color representation of the annihilating particle (3, 6 or 8)')
-parser.add_argument('-v', '--vars', nargs=4, required=True, help='the variables the cross section depends on: m, v, alpha_s, alpha_sommerfeld')
+parser.add_argument('-p', '--process', action='store', required=True, help='the annihilation process (sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg), several are separated by commas')
+parser.add_argument('-r', '--rep', action='store', required=True, help='the color representation of the annihilating particle (3, 6 or 8), several are separated by commas')
+variables = parser.add_mutually_exclusive_group(required=True)
+variables.add_argument('-v', '--vars', nargs=4, help='the variables the cross section depends on: m, v, alpha_s, alpha_sommerfeld')
+variables.add_argument('-b', '--batch', nargs='?', const='-', help='read the variables m, v, alpha_s, alpha_sommerfeld from the rows of this file (default: stdin), separated by whitespace or commas, and write each row followed by its cross sections')
 parser.add_argument('-s', '--sommerfeld', action='store_true', help='add sommerfeld corrections (default: off)')
 parser.add_argument('-l', '--lwave', action='store', default=2, help='corrections up to the lth partial wave (default l = 2)')
 parser.add_argument('-e', '--extended', action='store_true', help='Extended logging of the results')
+parser.add_argument('-j', '--jobs', action='store', type=int, default=1, help='number of processes which evaluate the rows in batch mode (default: 1)')
+backends = parser.add_mutually_exclusive_group()
+backends.add_argument('--reference', action='store_true', help='evaluate with mpmath at arbitrary precision instead of with the compiled cross sections of libsommerfeld (see sommerfeld_native.py)')
+backends.add_argument('-a', '--adaptive', nargs='?', type=float, const=1e-12, help='evaluate in double precision with a bound on the rounding error and again with mpmath at the precision needed if the relative error may exceed this tolerance (default: 1e-12)')
 args = parser.parse_args()
 
-# determine the process and representation
-process = args.process
-if not process in ['sstoqq', 'sstogg', 'fftoqq', 'fftogg', 'vvtoqq', 'vvtogg']:
-	print "Process " + process + " is not known, must be sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg."
-	sys.exit(2)
-rep = int(args.rep)
-if not rep in [3, 6, 8]:
-	print "Color representation " + str(rep) + " is not valid, must be 3, 6, or 8."
-	sys.exit(2)
+# determine the processes and representations
+processes = args.process.split(',')
+for process in processes:
+	if not process in ['sstoqq', 'sstogg', 'fftoqq', 'fftogg', 'vvtoqq', 'vvtogg']:
+		print "Process " + process + " is not known, must be sstoqq, sstogg, fftoqq, fftogg, vvtoqq or vvtogg."
+		sys.exit(2)
+reps = [int(rep) for rep in args.rep.split(',')]
+for rep in reps:
+	if not rep in [3, 6, 8]:
+		print "Color representation " + str(rep) + " is not valid, must be 3, 6, or 8."
+		sys.exit(2)
+combinations = [(process, rep) for process in processes for rep in reps]
+
+# determine partial wave and sommerfeld
+l = int(args.lwave);
+sommerfeld = args.sommerfeld
+
+# determine the backend, the compiled partial waves are used unless the reference or adaptive precision is asked for
+native = None
+if not args.reference and args.adaptive is None:
+	try:
+		import sommerfeld_native
+		sommerfeld_native.load_library()
+		native = sommerfeld_native
+	except (ImportError, OSError) as error:
+		sys.stderr.write("Compiled cross sections are not available, using mpmath: " + str(error) + "\n")
+
+# cross sections of all combinations for rows of the variables m, v, alpha_s and alpha_sommerfeld
+# (as strings), returns for each row the list of its cross sections (floats with the compiled ones)
+def evaluate(rows):
+	xsecs = []
+	columns = [[float(x) for x in column] for column in zip(*rows)]
+	for process, rep in combinations:
+		if native is not None:
+			xsecs.append(native.get_xsec(process, rep, l, sommerfeld, *columns).tolist())
+		elif args.adaptive is not None:
+			xsecs.append([get_xsec_adaptive(process, rep, l, sommerfeld, *(list(row) + [args.adaptive])) for row in rows])
+		else:
+			xsecs.append([get_xsec(process, rep, l, sommerfeld, *[mpmath.mpf(x) for x in row]) for row in rows])
+	return zip(*xsecs)
+
+# evaluates a chunk of the batch input and returns the output lines
+def evaluate_chunk(chunk):
+	xsecs = evaluate([fields for fields, separator in chunk])
+	return [separator.join(fields + ['%.15g' % xsec for xsec in row]) + '\n' for (fields, separator), row in zip(chunk, xsecs)]
+
+# reads the rows of the batch input in chunks of (fields, separator), rows which are not four numbers are skipped;
+# from a pipe or terminal a chunk is also returned when no further row is available yet, such that rows which
+# arrive one by one are answered right away
+def read_chunks(batch_file, size):
+	streaming = not stat.S_ISREG(os.fstat(batch_file.fileno()).st_mode)
+	chunk = []
+	for line in iter(batch_file.readline, ''):
+		line = line.strip()
+		if not line or line.startswith('#'):
+			continue
+		separator = ',' if ',' in line else ' '
+		fields = [field.strip() for field in line.split(',')] if separator == ',' else line.split()
+		try:
+			if len(fields) != 4:
+				raise ValueError
+			[float(field) for field in fields]
+		except ValueError:
+			sys.stderr.write("Skipping row which is not m, v, alpha_s, alpha_sommerfeld: " + line + "\n")
+			continue
+		chunk.append((fields, separator))
+		if len(chunk) == size or (streaming and not select.select([batch_file], [], [], 0)[0]):
+			yield chunk
+			chunk = []
+	if chunk:
+		yield chunk
+
+# batch mode: stream the cross sections of each row, the compiled cross sections evaluate
+# whole chunks of rows at once while mpmath evaluates the rows one by one (in chunks with
+# adaptive precision, which are cheap enough that the chunks save on the jobs' overhead)
+if args.batch is not None:
+	batch_file = sys.stdin if args.batch == '-' else open(args.batch)
+	sys.stdout.write("# m v alpha_s alpha_sommerfeld " + " ".join([process + "_" + str(rep) for process, rep in combinations]) + "\n")
+	chunks = read_chunks(batch_file, 1024 if native is not None else (64 if args.adaptive is not None else 1))
+	pool = None
+	if args.jobs > 1:
+		pool = multiprocessing.Pool(args.jobs)
+		results = pool.imap(evaluate_chunk, chunks)
+	else:
+		results = (evaluate_chunk(chunk) for chunk in chunks)
+	for lines in results:
+		sys.stdout.writelines(lines)
+		sys.stdout.flush()
+	if pool is not None:
+		pool.close()
+		pool.join()
+	sys.exit(0)
 
 # determine variables
 m = mpmath.mpf(args.vars[0])
@@ -247,19 +358,16 @@ v = mpmath.mpf(args.vars[1])
 alphas = mpmath.mpf(args.vars[2])
 alphasommerfeld = mpmath.mpf(args.vars[3])
 
-# determine partial wave and sommerfeld
-l = int(args.lwave);
-sommerfeld = args.sommerfeld
+# determine the cross sections
+xsecs = [mpmath.mpf(xsec) for xsec in evaluate([args.vars])[0]]
 
-# determine the cross section
-xsec = get_xsec(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld);
-
-# print the result
-if args.extended:
-	print "Annihilation cross section for " + process + " with color representation " + str(rep)
-	print "and m = " + str(m) + ", v = " + str(v) + ", alpha_s = " + str(alphas) + ", alpha_sommerfeld = " + str(alphasommerfeld)
-	print "and for l = " + str(l) + " and sommerfeld " + str(sommerfeld) + " equals:"
-	print "\t" + mpmath.nstr(xsec, 15)
-else:
-	print mpmath.nstr(xsec, 15)
+# print the results
+for (process, rep), xsec in zip(combinations, xsecs):
+	if args.extended:
+		print "Annihilation cross section for " + process + " with color representation " + str(rep)
+		print "and m = " + str(m) + ", v = " + str(v) + ", alpha_s = " + str(alphas) + ", alpha_sommerfeld = " + str(alphasommerfeld)
+		print "and for l = " + str(l) + " and sommerfeld " + str(sommerfeld) + " equals:"
+		print "\t" + mpmath.nstr(xsec, 15)
+	else:
+		print mpmath.nstr(xsec, 15)
 
@@ -0,0 +1,111 @@
+#! /usr/bin/env python
+
+# Compiled backend for the cross sections of sommerfeld.py. These are the cross sections
+# which the notebook and kernel_codegen.py write into main_micromegas.c, called through
+# the library libsommerfeld (see sommerfeld.h for how to build it) for numpy arrays of
+# m, v, alpha_s and alpha_sommerfeld. The arrays are broadcast against each other and the
+# cross sections (in 1/GeV^2) are returned with the broadcast shape. The partial waves are
+# evaluated at once by get_waves, get_xsec sums them up to l as sommerfeld.py does.
+#
+# The library is loaded from the path in the environment variable SOMMERFELD_LIBRARY, from
+# the folder of this file or else by the loader of the system.
+#
+# Usage:
+#	import numpy, sommerfeld_native
+#	v = numpy.linspace(0.01, 0.5, 50)
+#	xsec = sommerfeld_native.get_xsec('fftogg', 8, 2, True, 1000.0, v, 0.1, 0.12)
+#	waves = sommerfeld_native.get_waves('fftogg', 8, True, 1000.0, v, 0.1, 0.12)
+
+import os
+import ctypes
+import numpy
+
+
+#############
+# interface #
+#############
+
+# version of the interface of the library which this module uses
+SOMMERFELD_ABI_VERSION = 2
+
+# spin as coded in the PDG number of the model and whether the final state are gluons
+processes = {
+	'sstoqq': (1, False),
+	'sstogg': (1, True),
+	'fftoqq': (3, False),
+	'fftogg': (3, True),
+	'vvtoqq': (5, False),
+	'vvtogg': (5, True),
+}
+
+# highest partial wave of the cross sections in main_micromegas.c and number of partial waves
+max_lwave = 2
+nr_waves = 5
+
+library = None
+
+def load_library():
+	global library
+	if library is not None:
+		return library
+	names = ['libsommerfeld.so', 'libsommerfeld.dylib']
+	candidates = []
+	if 'SOMMERFELD_LIBRARY' in os.environ:
+		candidates.append(os.environ['SOMMERFELD_LIBRARY'])
+	candidates += [os.path.join(os.path.dirname(os.path.abspath(__file__)), name) for name in names]
+	candidates += names
+	errors = []
+	for candidate in candidates:
+		try:
+			lib = ctypes.CDLL(candidate)
+		except OSError as error:
+			errors.append(str(error))
+			continue
+		lib.sommerfeld_abi_version.restype = ctypes.c_int
+		lib.sommerfeld_abi_version.argtypes = []
+		if lib.sommerfeld_abi_version() != SOMMERFELD_ABI_VERSION:
+			errors.append(candidate + ': interface version ' + str(lib.sommerfeld_abi_version()) + ' instead of ' + str(SOMMERFELD_ABI_VERSION))
+			continue
+		array = ctypes.POINTER(ctypes.c_double)
+		for function in [lib.sommerfeld_xx_to_qq_array, lib.sommerfeld_xx_to_gg_array]:
+			function.restype = None
+			function.argtypes = [ctypes.c_int, ctypes.c_int, ctypes.c_int, array, array, array, array, array, ctypes.c_long]
+		for function in [lib.sommerfeld_xx_to_qq_waves_array, lib.sommerfeld_xx_to_gg_waves_array]:
+			function.restype = None
+			function.argtypes = [ctypes.c_int, ctypes.c_int, ctypes.c_int, array, array, array, array, array, ctypes.c_long]
+		library = lib
+		return library
+	raise OSError('libsommerfeld can not be loaded, build it as described in sommerfeld.h (' + '; '.join(errors) + ')')
+
+
+##################
+# xsec functions #
+##################
+
+# broadcasts the inputs and calls the array function of the library with nr values per point
+def call_array(name, process, rep, sommerfeld, m, v, alphas, alphasommerfeld, nr):
+	if not process in processes:
+		raise ValueError('process ' + str(process) + ' is not known, must be one of ' + ', '.join(sorted(processes)))
+	lib = load_library()
+	spin, gluons = processes[process]
+	function = getattr(lib, 'sommerfeld_xx_to_' + ('gg' if gluons else 'qq') + name)
+
+	# broadcast the inputs and pass them as contiguous arrays of doubles
+	inputs = numpy.broadcast_arrays(*[numpy.asarray(x, dtype=numpy.float64) for x in [alphas, alphasommerfeld, m, v]])
+	shape = inputs[0].shape
+	inputs = [numpy.ascontiguousarray(x).ravel() for x in inputs]
+	out = numpy.empty(inputs[0].size * nr, dtype=numpy.float64)
+	pointers = [x.ctypes.data_as(ctypes.POINTER(ctypes.c_double)) for x in inputs + [out]]
+	function(spin, int(rep), int(bool(sommerfeld)), *(pointers + [inputs[0].size]))
+	return out.reshape(shape + ((nr,) if nr > 1 else ()))
+
+# partial waves l = 0, ..., nr_waves - 1 along the last axis
+def get_waves(process, rep, sommerfeld, m, v, alphas, alphasommerfeld):
+	return call_array('_waves_array', process, rep, sommerfeld, m, v, alphas, alphasommerfeld, nr_waves)
+
+def get_xsec(process, rep, l, sommerfeld, m, v, alphas, alphasommerfeld):
+	# the sum up to max_lwave is a single kernel, other truncations sum the partial waves
+	if l == max_lwave:
+		return call_array('_array', process, rep, sommerfeld, m, v, alphas, alphasommerfeld, 1)
+	waves = get_waves(process, rep, sommerfeld, m, v, alphas, alphasommerfeld)
+	return waves[..., :max(0, l + 1)].sum(axis=-1)